@@ -13,37 +13,74 @@ enum State {
 	UNLOADING      # Being removed from world
 }
 
+## Face neighbor slots, in BinaryGreedyMesher.Face order (opposite slot = index ^ 1)
+const NEIGHBOR_OFFSETS: Array[Vector3i] = [
+	Vector3i(1, 0, 0), Vector3i(-1, 0, 0),
+	Vector3i(0, 1, 0), Vector3i(0, -1, 0),
+	Vector3i(0, 0, 1), Vector3i(0, 0, -1)
+]
+
+## neighbor_mask with all six slots linked
+const ALL_NEIGHBORS: int = 0x3F
+
 ## Chunk position in chunk coordinates
 var position: Vector3i = Vector3i.ZERO
 
 ## Voxel data storage
 var voxel_data: VoxelData = null
 
+## Block light and sky light (set by ChunkManager when the chunk activates, null if unlit)
+var light: ChunkLight = null
+
 ## Mesh instance for rendering (created by ChunkManager)
 var mesh_instance: MeshInstance3D = null
 
-## Cached mesh arrays for region batching (avoid rebuilding mesh from voxels every time)
-## This is the key optimization: build once, reuse many times
+## Region-local mesh arrays waiting for upload to the chunk's region slot (region batching)
+## Cleared once uploaded - the region buffer keeps its own encoded copy
 var cached_mesh_arrays: Array = []
 
+## Region-local translucent (liquid, glass, leaves) mesh arrays waiting for upload, as above
+var cached_translucent_arrays: Array = []
+
+## Quads of the last applied mesh grouped by (face, slice), the base of partial remeshes
+## (null until the chunk is meshed on a worker)
+var quad_cache: ChunkQuadCache = null
+
+## Slices whose quads may have changed since quad_cache was meshed: X, Y and Z slice
+## bitmasks (empty = none). Set by voxel edits and light changes (mark_slices_dirty)
+var dirty_slices: PackedInt64Array = PackedInt64Array()
+
+## Set when the mesh inputs changed in a way slices don't track (first mesh, a neighbor
+## loaded): the next mesh must mesh every slice
+var needs_full_mesh: bool = true
+
 ## Collision shape (if needed)
 var collision_shape: CollisionShape3D = null
 
+## Slot in ChunkManager's FrustumCuller bounds table (-1 = not registered)
+## Only used when the chunk has its own mesh instance (region batching disabled)
+var cull_slot: int = -1
+
 ## Current state
 var state: State = State.INACTIVE
 
 ## Is the mesh dirty and needs rebuilding?
 var is_mesh_dirty: bool = false
 
-## Cached references to neighboring chunks (for cross-chunk face culling)
-var neighbors: Dictionary = {
-	"north": null,  # +Z
-	"south": null,  # -Z
-	"east": null,   # +X
-	"west": null,   # -X
-	"up": null,     # +Y
-	"down": null    # -Y
-}
+## Face-to-face visibility through this chunk (BinaryGreedyMesher connectivity set)
+## Computed when the chunk is meshed; assumed fully connected until then
+var face_connectivity: int = BinaryGreedyMesher.CONNECTIVITY_ALL
+
+## Linked face neighbors (for cross-chunk face culling), indexed by BinaryGreedyMesher.Face
+## ChunkManager links and unlinks them as chunks load and unload
+var neighbors: Array[Chunk] = [null, null, null, null, null, null]
+
+## One bit per linked neighbor slot (ALL_NEIGHBORS = all six loaded)
+var neighbor_mask: int = 0
+
+## neighbor_mask when the last mesh snapshot was captured (-1 = unknown): neighbors linked
+## or unlinked since then aren't reflected in the mesh's border faces
+var meshed_neighbor_mask: int = -1
 
 ## Last time this chunk was accessed (for LRU cache management)
 var last_access_time: int = 0
@@ -53,6 +90,12 @@ func initialize(chunk_pos: Vector3i) -> void:
 	position = chunk_pos
 	state = State.INACTIVE
 	is_mesh_dirty = true
+	face_connectivity = BinaryGreedyMesher.CONNECTIVITY_ALL
+	light = null
+	quad_cache = null
+	dirty_slices = PackedInt64Array()
+	needs_full_mesh = true
+	meshed_neighbor_mask = -1
 	last_access_time = Time.get_ticks_msec()
 
 	# Create or reset voxel data
@@ -64,21 +107,21 @@ func initialize(chunk_pos: Vector3i) -> void:
 		voxel_data.chunk_size_y = ChunkHeightZones.get_chunk_height_for_chunk(chunk_pos)
 		voxel_data.fill(VoxelTypes.Type.AIR)
 
-	# Clear neighbor references
-	for key in neighbors.keys():
-		neighbors[key] = null
+	clear_neighbors()
 
 ## Clean up chunk for return to pool
 func cleanup() -> void:
 	state = State.INACTIVE
 	is_mesh_dirty = false
+	light = null
+	quad_cache = null
+	dirty_slices = PackedInt64Array()
 
-	# Clear neighbor references
-	for key in neighbors.keys():
-		neighbors[key] = null
+	clear_neighbors()
 
 	# Clear cached mesh arrays
 	cached_mesh_arrays.clear()
+	cached_translucent_arrays.clear()
 
 	# Clear any mesh-related metadata to prevent stale references
 	if has_meta("old_mesh_instance"):
@@ -102,6 +145,30 @@ func set_voxel(local_pos: Vector3i, voxel_type: int) -> void:
 		is_mesh_dirty = true
 		# Invalidate cached mesh arrays since voxel data changed
 		cached_mesh_arrays.clear()
+		cached_translucent_arrays.clear()
+
+## Write many voxels at once (indices as VoxelData.get_index), invalidating the mesh once
+## Returns the previous type of each written voxel
+func set_voxels(voxel_indices: PackedInt32Array, voxel_types: PackedByteArray) -> PackedByteArray:
+	var old_types := voxel_data.set_voxels(voxel_indices, voxel_types)
+	is_mesh_dirty = true
+	cached_mesh_arrays.clear()
+	cached_translucent_arrays.clear()
+	return old_types
+
+## Record a voxel or light change at local_pos (may lie just outside the chunk, in a
+## neighbor): faces in its slice and the slices on either side of it can change
+## (visibility, AO and the light of the cell in front)
+func mark_slices_dirty(local_pos: Vector3i) -> void:
+	if dirty_slices.is_empty():
+		dirty_slices = PackedInt64Array([0, 0, 0])
+	dirty_slices[0] |= ChunkQuadCache.get_slice_bits(local_pos.x, VoxelData.CHUNK_SIZE_XZ)
+	dirty_slices[1] |= ChunkQuadCache.get_slice_bits(local_pos.y, voxel_data.chunk_size_y)
+	dirty_slices[2] |= ChunkQuadCache.get_slice_bits(local_pos.z, VoxelData.CHUNK_SIZE_XZ)
+
+## Check if the next mesh can re-mesh only the dirty slices
+func can_mesh_partially() -> bool:
+	return not needs_full_mesh and quad_cache != null and not dirty_slices.is_empty()
 
 ## Convert local position to world position
 func local_to_world(local_pos: Vector3i) -> Vector3i:
@@ -137,31 +204,34 @@ func is_full() -> bool:
 		return voxel_data.is_full()
 	return false
 
-## Get neighbor chunk in a direction
-func get_neighbor(direction: String) -> Chunk:
-	if direction in neighbors:
-		return neighbors[direction]
-	return null
+## Get the neighbor chunk in a face slot (null if not loaded)
+func get_neighbor(face: int) -> Chunk:
+	return neighbors[face]
+
+## Link or unlink (null) the neighbor in a face slot
+func set_neighbor(face: int, neighbor: Chunk) -> void:
+	neighbors[face] = neighbor
+	if neighbor:
+		neighbor_mask |= 1 << face
+	else:
+		neighbor_mask &= ~(1 << face)
 
-## Set neighbor chunk reference
-func set_neighbor(direction: String, neighbor: Chunk) -> void:
-	if direction in neighbors:
-		neighbors[direction] = neighbor
+## Unlink all neighbors
+func clear_neighbors() -> void:
+	neighbors.fill(null)
+	neighbor_mask = 0
 
 ## Get all valid neighbor chunks
 func get_all_neighbors() -> Array[Chunk]:
 	var result: Array[Chunk] = []
-	for neighbor in neighbors.values():
+	for neighbor in neighbors:
 		if neighbor != null:
 			result.append(neighbor)
 	return result
 
 ## Check if we have all 6 neighbors loaded
 func has_all_neighbors() -> bool:
-	for neighbor in neighbors.values():
-		if neighbor == null:
-			return false
-	return true
+	return neighbor_mask == ALL_NEIGHBORS
 
 ## Calculate distance to a position (squared, for performance)
 func distance_squared_to(pos: Vector3) -> float:
@@ -233,6 +303,10 @@ func get_memory_usage() -> int:
 	var total := 0
 	if voxel_data:
 		total += voxel_data.get_memory_usage()
+	if light:
+		total += light.get_memory_usage()
+	if quad_cache:
+		total += quad_cache.get_memory_usage()
 	# Add mesh memory if needed (mesh size can be calculated from vertex count)
 	return total
 
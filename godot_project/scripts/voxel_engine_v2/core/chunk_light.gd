@@ -0,0 +1,82 @@
+## ChunkLight - Per-chunk 4-bit block light and sky light (nibble storage)
+## Two voxels share a byte in each channel, so a 16x16x16 chunk holds both channels in
+## 4 KB (half a byte per voxel per channel). Same voxel index order as VoxelData
+##
+## Channels are allocated lazily: an empty array reads as fully dark, which is the state
+## of every buried chunk (block light only exists near emitters, sky light above ground)
+class_name ChunkLight
+extends RefCounted
+
+## Light channels
+const CHANNEL_BLOCK: int = 0  # Emitted by blocks (VoxelTypes light_level), e.g. lava
+const CHANNEL_SKY: int = 1    # Sunlight, 15 in open air and straight down from it
+
+## Brightest light level (4 bits)
+const MAX_LEVEL: int = 15
+
+## Voxels in the chunk (CHUNK_SIZE_XZ * chunk_size_y * CHUNK_SIZE_XZ)
+var volume: int = 0
+
+## Nibble-packed channels (voxel i lives in byte i >> 1, low nibble for even i)
+var block: PackedByteArray = PackedByteArray()
+var sky: PackedByteArray = PackedByteArray()
+
+func _init(chunk_volume: int = 0) -> void:
+	volume = chunk_volume
+
+## Forget all light (pooled chunks reuse their ChunkLight)
+func reset(chunk_volume: int) -> void:
+	volume = chunk_volume
+	block = PackedByteArray()
+	sky = PackedByteArray()
+
+## Get one channel's level at a voxel index
+func get_light(channel: int, index: int) -> int:
+	var data := sky if channel == CHANNEL_SKY else block
+	if data.is_empty():
+		return 0
+	return (data[index >> 1] >> ((index & 1) << 2)) & 0xF
+
+## Set one channel's level at a voxel index (allocates the channel on the first non-zero write)
+func set_light(channel: int, index: int, level: int) -> void:
+	if channel == CHANNEL_SKY:
+		if sky.is_empty():
+			if level == 0:
+				return
+			sky = _allocate()
+		sky[index >> 1] = _write_nibble(sky[index >> 1], index, level)
+	else:
+		if block.is_empty():
+			if level == 0:
+				return
+			block = _allocate()
+		block[index >> 1] = _write_nibble(block[index >> 1], index, level)
+
+## Level baked into meshes: the brighter of the two channels
+func get_level(index: int) -> int:
+	return maxi(get_light(CHANNEL_SKY, index), get_light(CHANNEL_BLOCK, index))
+
+## Check if both channels are unallocated (fully dark)
+func is_dark() -> bool:
+	return block.is_empty() and sky.is_empty()
+
+## Read-only snapshot for worker threads (packed arrays are copy-on-write, so this is O(1))
+func snapshot() -> ChunkLight:
+	var snap := ChunkLight.new(volume)
+	snap.block = block
+	snap.sky = sky
+	return snap
+
+## Get memory usage in bytes
+func get_memory_usage() -> int:
+	return block.size() + sky.size()
+
+func _allocate() -> PackedByteArray:
+	var data := PackedByteArray()
+	data.resize((volume + 1) >> 1)
+	data.fill(0)
+	return data
+
+static func _write_nibble(byte: int, index: int, level: int) -> int:
+	var shift := (index & 1) << 2
+	return (byte & ~(0xF << shift)) | ((level & 0xF) << shift)
@@ -0,0 +1,130 @@
+## ChunkMap - Active chunks keyed by packed chunk coordinates, stored densely
+## A chunk position packs into one int (21 bits per axis), so lookups hash a plain int
+## instead of a Vector3i Variant, and neighbor keys are one addition away (KEY_STEP_*)
+## The chunks themselves live in a dense array (removal swaps the last one into the gap):
+## passes over every chunk walk that array instead of building keys()/values() copies
+class_name ChunkMap
+extends RefCounted
+
+## Bits per packed axis (chunk coordinates from -2^20 to 2^20 - 1)
+const KEY_AXIS_BITS: int = 21
+const KEY_AXIS_MASK: int = (1 << KEY_AXIS_BITS) - 1
+const KEY_AXIS_BIAS: int = 1 << (KEY_AXIS_BITS - 1)
+
+## Key difference of one chunk step along each axis
+const KEY_STEP_X: int = 1
+const KEY_STEP_Y: int = 1 << KEY_AXIS_BITS
+const KEY_STEP_Z: int = 1 << (KEY_AXIS_BITS * 2)
+
+## Packed key -> index into the dense arrays
+var _slots: Dictionary = {}
+
+## Dense storage (same order in both arrays)
+var _keys: PackedInt64Array = PackedInt64Array()
+var _chunks: Array[Chunk] = []
+
+## Pack a chunk position into a key
+static func pack_key(chunk_pos: Vector3i) -> int:
+	return (((chunk_pos.x + KEY_AXIS_BIAS) & KEY_AXIS_MASK) |
+			(((chunk_pos.y + KEY_AXIS_BIAS) & KEY_AXIS_MASK) << KEY_AXIS_BITS) |
+			(((chunk_pos.z + KEY_AXIS_BIAS) & KEY_AXIS_MASK) << (KEY_AXIS_BITS * 2)))
+
+## Unpack a key into a chunk position
+static func unpack_key(key: int) -> Vector3i:
+	return Vector3i(
+		(key & KEY_AXIS_MASK) - KEY_AXIS_BIAS,
+		((key >> KEY_AXIS_BITS) & KEY_AXIS_MASK) - KEY_AXIS_BIAS,
+		((key >> (KEY_AXIS_BITS * 2)) & KEY_AXIS_MASK) - KEY_AXIS_BIAS
+	)
+
+## Get the chunk at a position (null if none)
+func get_chunk(chunk_pos: Vector3i) -> Chunk:
+	return get_chunk_by_key(pack_key(chunk_pos))
+
+## Get the chunk at a packed key (null if none)
+func get_chunk_by_key(key: int) -> Chunk:
+	var slot: int = _slots.get(key, -1)
+	return _chunks[slot] if slot >= 0 else null
+
+## Check if a position holds a chunk
+func has(chunk_pos: Vector3i) -> bool:
+	return _slots.has(pack_key(chunk_pos))
+
+## Add or replace the chunk at a position
+func insert(chunk_pos: Vector3i, chunk: Chunk) -> void:
+	var key := pack_key(chunk_pos)
+	var slot: int = _slots.get(key, -1)
+	if slot >= 0:
+		_chunks[slot] = chunk
+		return
+	_slots[key] = _chunks.size()
+	_keys.append(key)
+	_chunks.append(chunk)
+
+## Remove the chunk at a position, returns false if there was none
+func erase(chunk_pos: Vector3i) -> bool:
+	var key := pack_key(chunk_pos)
+	var slot: int = _slots.get(key, -1)
+	if slot < 0:
+		return false
+
+	# Move the last chunk into the freed slot
+	var last := _chunks.size() - 1
+	if slot != last:
+		_keys[slot] = _keys[last]
+		_chunks[slot] = _chunks[last]
+		_slots[_keys[slot]] = slot
+	_keys.resize(last)
+	_chunks.resize(last)
+	_slots.erase(key)
+	return true
+
+## Number of chunks
+func size() -> int:
+	return _chunks.size()
+
+func is_empty() -> bool:
+	return _chunks.is_empty()
+
+## Remove every chunk
+func clear() -> void:
+	_slots.clear()
+	_keys.clear()
+	_chunks.clear()
+
+## All chunks, densely (the live array - copy it before inserting or erasing while iterating)
+func get_chunks() -> Array[Chunk]:
+	return _chunks
+
+## Positions of all chunks (a new array, safe to erase while iterating it)
+func get_positions() -> Array[Vector3i]:
+	var positions: Array[Vector3i] = []
+	positions.resize(_keys.size())
+	for i in range(_keys.size()):
+		positions[i] = unpack_key(_keys[i])
+	return positions
+
+## Chunks inside a box of chunk positions (inclusive)
+## Small boxes probe each position; boxes holding more positions than there are chunks
+## scan the dense array instead
+func get_chunks_in_box(min_pos: Vector3i, max_pos: Vector3i) -> Array[Chunk]:
+	var result: Array[Chunk] = []
+	var extent := (max_pos - min_pos) + Vector3i.ONE
+	if extent.x <= 0 or extent.y <= 0 or extent.z <= 0:
+		return result
+
+	if extent.x * extent.y * extent.z <= _chunks.size():
+		for z in range(min_pos.z, max_pos.z + 1):
+			for y in range(min_pos.y, max_pos.y + 1):
+				var key := pack_key(Vector3i(min_pos.x, y, z))
+				for x in range(extent.x):
+					var slot: int = _slots.get(key + x * KEY_STEP_X, -1)
+					if slot >= 0:
+						result.append(_chunks[slot])
+	else:
+		for chunk in _chunks:
+			var pos := chunk.position
+			if pos.x >= min_pos.x and pos.x <= max_pos.x and pos.y >= min_pos.y and pos.y <= max_pos.y \
+					and pos.z >= min_pos.z and pos.z <= max_pos.z:
+				result.append(chunk)
+	return result
@@ -0,0 +1,92 @@
+## ChunkQuadCache - A chunk's greedy-meshed quads grouped by (face, slice)
+## Kept after meshing so an edit re-meshes only the slices it touches (at most 3 per axis,
+## see Chunk.mark_slices_dirty) and splices them over the old groups of those slices
+##
+## Groups are packed arrays (copy-on-write), so copying the cache for a worker thread only
+## copies the group tables, not the quads
+class_name ChunkQuadCache
+extends RefCounted
+
+## Quads per group, key = face << 8 | slice (BinaryGreedyMesher packed quads)
+var opaque: Dictionary = {}
+var translucent: Dictionary = {}
+
+## Group the quads of a full mesh
+static func from_quads(opaque_quads: PackedInt64Array, translucent_quads: PackedInt64Array) -> ChunkQuadCache:
+	var cache := ChunkQuadCache.new()
+	_group_quads(cache.opaque, opaque_quads)
+	_group_quads(cache.translucent, translucent_quads)
+	return cache
+
+## Group key of a quad
+static func get_group_key(quad: int) -> int:
+	return (BinaryGreedyMesher.quad_face(quad) << 8) | BinaryGreedyMesher.quad_slice(quad)
+
+## Check if a group lies in a dirty slice (slice_masks: X, Y and Z slice bitmasks)
+static func is_group_dirty(key: int, slice_masks: PackedInt64Array) -> bool:
+	return ((slice_masks[(key >> 8) >> 1] >> (key & 0xFF)) & 1) != 0
+
+## Bits of the slices next to and at a coordinate (p - 1 .. p + 1), clipped to 0..size-1
+## A coordinate just outside the chunk (-1 or size) still marks the border slice
+static func get_slice_bits(p: int, size: int) -> int:
+	var low := maxi(p - 1, 0)
+	var high := mini(p + 1, size - 1)
+	if low > high:
+		return 0
+	return ((1 << (high - low + 1)) - 1) << low
+
+## Copy for a worker thread to splice into
+func duplicate_cache() -> ChunkQuadCache:
+	var copy := ChunkQuadCache.new()
+	copy.opaque = opaque.duplicate()
+	copy.translucent = translucent.duplicate()
+	return copy
+
+## Replace every group in a dirty slice with the partial mesh of those slices
+## (a dirty slice that produced no quads this time loses its group)
+func splice(partial: ChunkQuadCache, slice_masks: PackedInt64Array) -> void:
+	_splice_groups(opaque, partial.opaque, slice_masks)
+	_splice_groups(translucent, partial.translucent, slice_masks)
+
+## All opaque quads
+func get_opaque_quads() -> PackedInt64Array:
+	return _flatten(opaque)
+
+## All translucent quads
+func get_translucent_quads() -> PackedInt64Array:
+	return _flatten(translucent)
+
+## Get memory usage in bytes (8 bytes per quad)
+func get_memory_usage() -> int:
+	var quads := 0
+	for group in opaque.values():
+		quads += group.size()
+	for group in translucent.values():
+		quads += group.size()
+	return quads * 8
+
+static func _group_quads(groups: Dictionary, quads: PackedInt64Array) -> void:
+	# Collect into Arrays (shared by reference) first - appending to a packed array
+	# stored in a Dictionary would copy it on every write
+	var lists := {}
+	for quad in quads:
+		var key := get_group_key(quad)
+		var list: Array = lists.get(key, [])
+		if list.is_empty():
+			lists[key] = list
+		list.append(quad)
+	for key in lists:
+		groups[key] = PackedInt64Array(lists[key])
+
+static func _splice_groups(groups: Dictionary, partial_groups: Dictionary, slice_masks: PackedInt64Array) -> void:
+	for key in groups.keys():
+		if is_group_dirty(key, slice_masks):
+			groups.erase(key)
+	for key in partial_groups:
+		groups[key] = partial_groups[key]
+
+static func _flatten(groups: Dictionary) -> PackedInt64Array:
+	var quads := PackedInt64Array()
+	for group in groups.values():
+		quads.append_array(group)
+	return quads
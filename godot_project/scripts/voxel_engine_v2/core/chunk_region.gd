@@ -2,6 +2,15 @@
 ## Dramatically reduces draw calls by combining 8x8x8 chunks into one mesh
 ## Inspired by Sodium's region-based rendering approach
 ##
+## The mesh is a RegionMeshBuffer: each chunk owns a slot in one shared surface, so a
+## chunk change uploads only that chunk's vertices instead of rebuilding the region.
+## Vertices are packed region-local positions; the node transform supplies the region origin
+##
+## Translucent quads (liquids, glass, leaves) live in a second buffer drawn by its own
+## alpha-blended mesh instance. Its slots are kept back-to-front from the camera
+## (sort_translucent), refreshed when the camera moves into another region, and after an
+## upload whose slot landed out of that order (is_translucent_slot_ordered)
+##
 ## Performance Impact:
 ## - Before: 100 chunks = 100 draw calls
 ## - After:  100 chunks in ~2 regions = 2 draw calls (98% reduction!)
@@ -17,30 +26,43 @@ var region_position: Vector3i = Vector3i.ZERO
 ## Chunks contained in this region (chunk_pos -> Chunk)
 var chunks: Dictionary = {}
 
-## Combined mesh instance for all chunks in this region
+## Mesh instance drawing the region buffer (created with the first upload)
 var mesh_instance: MeshInstance3D = null
 
-## Is the combined mesh dirty and needs rebuilding?
-var is_dirty: bool = true
+## Slot-allocated mesh shared by all chunks in this region
+var mesh_buffer: RegionMeshBuffer = null
 
 ## Material to use for the combined mesh (shared across all regions)
 var material: Material = null
 
+## Mesh instance and slot buffer of the translucent pass (created with the first translucent upload)
+var translucent_instance: MeshInstance3D = null
+var translucent_buffer: RegionMeshBuffer = null
+
+## Material of the translucent pass (shared across all regions)
+var translucent_material: Material = null
+
+## Camera position the translucent slots were last sorted for (INF = never sorted)
+var translucent_sort_position: Vector3 = Vector3.INF
+
 ## Statistics
 var chunk_count: int = 0
 var vertex_count: int = 0
-var last_rebuild_time_ms: float = 0.0
+var last_upload_time_ms: float = 0.0
 
 ## Cached AABB (to avoid expensive per-frame recalculation)
 var cached_aabb: AABB = AABB()
 var aabb_is_valid: bool = false
 
+## Slot in ChunkManager's FrustumCuller bounds table (-1 = not registered)
+var cull_slot: int = -1
+
 ## Initialize region at given position
 func _init(pos: Vector3i = Vector3i.ZERO):
 	region_position = pos
 	name = "Region_%d_%d_%d" % [pos.x, pos.y, pos.z]
 
-## Add a chunk to this region
+## Add a chunk to this region (its mesh arrives through upload_chunk)
 func add_chunk(chunk: Chunk) -> void:
 	if not chunk:
 		return
@@ -48,14 +70,17 @@ func add_chunk(chunk: Chunk) -> void:
 	chunks[chunk.position] = chunk
 	chunk_count = chunks.size()
 	aabb_is_valid = false  # Invalidate cached AABB
-	mark_dirty()
 
-## Remove a chunk from this region
+## Remove a chunk from this region and release its mesh slot
 func remove_chunk(chunk_pos: Vector3i) -> void:
 	if chunks.erase(chunk_pos):
 		chunk_count = chunks.size()
 		aabb_is_valid = false  # Invalidate cached AABB
-		mark_dirty()
+	if mesh_buffer:
+		mesh_buffer.remove_chunk(chunk_pos)
+	if translucent_buffer:
+		translucent_buffer.remove_chunk(chunk_pos)
+	vertex_count = _count_vertices()
 
 ## Check if region contains a chunk
 func has_chunk(chunk_pos: Vector3i) -> bool:
@@ -65,189 +90,118 @@ func has_chunk(chunk_pos: Vector3i) -> bool:
 func get_chunk(chunk_pos: Vector3i) -> Chunk:
 	return chunks.get(chunk_pos)
 
-## Mark region mesh as dirty (needs rebuild)
-func mark_dirty() -> void:
-	is_dirty = true
-
-## Check if region needs mesh rebuild
-func needs_rebuild() -> bool:
-	return is_dirty and chunk_count > 0
-
-## Frame time budget for region rebuilds (milliseconds)
-## If rebuilding takes longer than this, we should reduce the rate
-const REBUILD_TIME_BUDGET_MS: float = 8.0  # Target 16ms frame time, use max 8ms for rebuilds
-
-## Rebuild the combined mesh from all chunks in this region
-## This is the core optimization - combines many chunks into one draw call
-func rebuild_combined_mesh(mesh_builder) -> void:
-	if not mesh_builder:
-		push_error("[ChunkRegion] No mesh builder provided for rebuild")
-		return
-
-	var start_time := Time.get_ticks_usec()  # Use microseconds for better precision
-
-	# Clear existing mesh
-	if mesh_instance:
-		remove_child(mesh_instance)
-		mesh_instance.queue_free()
-		mesh_instance = null
-
-	# If no chunks, nothing to build
-	if chunks.is_empty():
-		is_dirty = false
-		return
-
-	# Combine all chunk meshes into one
-	var combined_arrays: Array = []
-	combined_arrays.resize(Mesh.ARRAY_MAX)
-
-	# Initialize arrays
-	var vertices := PackedVector3Array()
-	var normals := PackedVector3Array()
-	var colors := PackedColorArray()
-	var uvs := PackedVector2Array()
-	var indices := PackedInt32Array()
-
-	var vertex_offset := 0
-	var total_chunks_processed := 0
-	var cache_hits := 0
-	var cache_misses := 0
-
-	# Process each chunk in the region
-	for chunk in chunks.values():
-		# Skip invalid or empty chunks
-		if not chunk or not is_instance_valid(chunk) or chunk.is_empty():
-			continue
-
-		# Skip chunks that aren't fully ready
-		if chunk.state != Chunk.State.ACTIVE:
-			continue
-
-		# Use cached mesh arrays if available (MAJOR OPTIMIZATION)
-		# This avoids rebuilding the mesh from voxel data every time
-		var chunk_arrays: Array = []
-		if not chunk.cached_mesh_arrays.is_empty():
-			# Cache hit - use pre-built arrays (FAST!)
-			chunk_arrays = chunk.cached_mesh_arrays
-			cache_hits += 1
-		else:
-			# Cache miss - build mesh arrays and cache them (SLOW!)
-			# This should only happen during the first region rebuild after chunk load
-			chunk_arrays = mesh_builder.build_mesh_arrays(chunk)
-			chunk.cached_mesh_arrays = chunk_arrays
-			cache_misses += 1
-
-		if chunk_arrays.is_empty():
-			continue
-
-		# Get the arrays from the chunk mesh data (handle null values)
-		var chunk_vertices: PackedVector3Array = chunk_arrays[Mesh.ARRAY_VERTEX] if (chunk_arrays.size() > Mesh.ARRAY_VERTEX and chunk_arrays[Mesh.ARRAY_VERTEX] != null) else PackedVector3Array()
-		var chunk_normals: PackedVector3Array = chunk_arrays[Mesh.ARRAY_NORMAL] if (chunk_arrays.size() > Mesh.ARRAY_NORMAL and chunk_arrays[Mesh.ARRAY_NORMAL] != null) else PackedVector3Array()
-		var chunk_colors: PackedColorArray = chunk_arrays[Mesh.ARRAY_COLOR] if (chunk_arrays.size() > Mesh.ARRAY_COLOR and chunk_arrays[Mesh.ARRAY_COLOR] != null) else PackedColorArray()
-		var chunk_uvs: PackedVector2Array = chunk_arrays[Mesh.ARRAY_TEX_UV] if (chunk_arrays.size() > Mesh.ARRAY_TEX_UV and chunk_arrays[Mesh.ARRAY_TEX_UV] != null) else PackedVector2Array()
-		var chunk_indices: PackedInt32Array = chunk_arrays[Mesh.ARRAY_INDEX] if (chunk_arrays.size() > Mesh.ARRAY_INDEX and chunk_arrays[Mesh.ARRAY_INDEX] != null) else PackedInt32Array()
-
-		if chunk_vertices.is_empty():
-			continue
-
-		# Offset vertices by chunk position (relative to region origin)
-		var chunk_offset: Vector3 = chunk.get_world_position() - get_region_world_position()
-
-		for i in range(chunk_vertices.size()):
-			vertices.append(chunk_vertices[i] + chunk_offset)
-
-		# Append normals
-		normals.append_array(chunk_normals)
-
-		# Append colors
-		colors.append_array(chunk_colors)
-
-		# Append UVs
-		uvs.append_array(chunk_uvs)
-
-		# Append indices (with vertex offset applied)
-		for idx in chunk_indices:
-			indices.append(idx + vertex_offset)
-
-		vertex_offset += chunk_vertices.size()
-		total_chunks_processed += 1
-
-	# If no geometry was generated, we're done
-	if vertices.is_empty():
-		is_dirty = false
-		return
-
-	# Build the combined mesh - only include arrays that have proper data
-	combined_arrays[Mesh.ARRAY_VERTEX] = vertices
-
-	# Only include normals if we have them for all vertices
-	if normals.size() == vertices.size():
-		combined_arrays[Mesh.ARRAY_NORMAL] = normals
-	elif normals.size() > 0:
-		print("[ChunkRegion] Warning: Normal count (%d) doesn't match vertex count (%d)" % [normals.size(), vertices.size()])
-
-	# Only include colors if we have them for all vertices
-	if colors.size() == vertices.size():
-		combined_arrays[Mesh.ARRAY_COLOR] = colors
-	elif colors.size() > 0:
-		print("[ChunkRegion] Warning: Color count (%d) doesn't match vertex count (%d)" % [colors.size(), vertices.size()])
-
-	# Only include UVs if we have them for all vertices
-	if uvs.size() == vertices.size():
-		combined_arrays[Mesh.ARRAY_TEX_UV] = uvs
-	elif uvs.size() > 0:
-		print("[ChunkRegion] Warning: UV count (%d) doesn't match vertex count (%d)" % [uvs.size(), vertices.size()])
-
-	# Always include indices if we have them
-	if not indices.is_empty():
-		combined_arrays[Mesh.ARRAY_INDEX] = indices
-
-	# Create ArrayMesh with compression (Sodium-inspired optimization)
-	# Use Godot 4's ARRAY_FLAG_COMPRESS_ATTRIBUTES to compress normals, colors, uvs
-	var array_mesh := ArrayMesh.new()
-	var compression_flags: int = Mesh.ARRAY_FLAG_COMPRESS_ATTRIBUTES
-	array_mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, combined_arrays, [], {}, compression_flags)
-
-	# Create MeshInstance3D
-	mesh_instance = MeshInstance3D.new()
-	mesh_instance.mesh = array_mesh
-
-	# Apply material if available
-	if material:
-		mesh_instance.material_override = material
-
-	# Position at region origin
-	mesh_instance.position = Vector3.ZERO  # Vertices are already offset
-
-	# Add to scene
-	add_child(mesh_instance)
-
-	# Update stats
-	vertex_count = vertices.size()
-	is_dirty = false
-	var rebuild_time_us := Time.get_ticks_usec() - start_time
-	last_rebuild_time_ms = rebuild_time_us / 1000.0
-
-	# Log performance (always show during initial load to demonstrate improvement)
-	var cache_hit_rate := (cache_hits * 100.0 / total_chunks_processed) if total_chunks_processed > 0 else 0.0
-	if last_rebuild_time_ms > REBUILD_TIME_BUDGET_MS or cache_misses > 0:
-		print("[ChunkRegion] Region %s: %.1fms, %d chunks (%d vertices), cache: %d hits/%d misses (%.0f%% hit rate)" % [
-			region_position, last_rebuild_time_ms, total_chunks_processed, vertex_count,
-			cache_hits, cache_misses, cache_hit_rate
-		])
+## Upload one chunk's opaque and translucent mesh arrays (region-local, see
+## get_chunk_mesh_offset) into its slots. Empty arrays release the slot
+## Returns the number of bytes uploaded
+func upload_chunk(chunk_pos: Vector3i, arrays: Array, translucent_arrays: Array = []) -> int:
+	var start_time := Time.get_ticks_usec()
+	var bytes := 0
+
+	if mesh_buffer or not arrays.is_empty():
+		if not mesh_buffer:
+			mesh_buffer = RegionMeshBuffer.new(_get_local_bounds())
+			mesh_instance = _create_buffer_instance(mesh_buffer, material)
+		bytes += mesh_buffer.set_chunk(chunk_pos, arrays)
+
+	if translucent_buffer or not translucent_arrays.is_empty():
+		if not translucent_buffer:
+			translucent_buffer = RegionMeshBuffer.new(_get_local_bounds())
+			translucent_instance = _create_buffer_instance(translucent_buffer, translucent_material)
+			# Water and glass would cast solid shadows
+			translucent_instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_OFF
+		bytes += translucent_buffer.set_chunk(chunk_pos, translucent_arrays)
+
+	vertex_count = _count_vertices()
+	last_upload_time_ms = (Time.get_ticks_usec() - start_time) / 1000.0
+	return bytes
+
+## Order the translucent slots back-to-front from a camera position (farthest chunk first)
+## Whole chunks are ordered, not single quads; returns the number of bytes uploaded
+func sort_translucent(camera_position: Vector3) -> int:
+	translucent_sort_position = camera_position
+	if not translucent_buffer or translucent_buffer.slots.is_empty():
+		return 0
+
+	var distances := {}
+	for chunk_pos in translucent_buffer.slots:
+		distances[chunk_pos] = _get_sort_distance(chunk_pos)
+
+	var order := translucent_buffer.slots.keys()
+	order.sort_custom(func(a, b): return distances[a] > distances[b])
+	return translucent_buffer.reorder(order)
+
+## Check if a chunk's translucent slot keeps the order of the last sort: every slot before
+## it is at least as far from the sort position, every slot after it at most as far
+func is_translucent_slot_ordered(chunk_pos: Vector3i) -> bool:
+	if not translucent_buffer or not translucent_buffer.slots.has(chunk_pos):
+		return true
+	if translucent_sort_position == Vector3.INF:
+		return false
+
+	var first_quad: int = translucent_buffer.slots[chunk_pos].x
+	var distance := _get_sort_distance(chunk_pos)
+	for other_pos in translucent_buffer.slots:
+		var other_first: int = translucent_buffer.slots[other_pos].x
+		if other_first < first_quad and _get_sort_distance(other_pos) < distance:
+			return false
+		if other_first > first_quad and _get_sort_distance(other_pos) > distance:
+			return false
+	return true
+
+## Squared distance from the last sort position to a chunk's center
+func _get_sort_distance(chunk_pos: Vector3i) -> float:
+	var center := ChunkHeightZones.get_chunk_world_bounds(chunk_pos).get_center()
+	return center.distance_squared_to(translucent_sort_position)
+
+## Create a mesh instance drawing a region buffer
+func _create_buffer_instance(buffer: RegionMeshBuffer, buffer_material: Material) -> MeshInstance3D:
+	var instance := MeshInstance3D.new()
+	instance.mesh = buffer.mesh
+	if buffer_material:
+		instance.material_override = buffer_material
+	instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_ON
+	add_child(instance)
+	return instance
+
+## Vertices owned by the slots of both buffers
+func _count_vertices() -> int:
+	var count := 0
+	if mesh_buffer:
+		count += mesh_buffer.get_vertex_count()
+	if translucent_buffer:
+		count += translucent_buffer.get_vertex_count()
+	return count
+
+## Box (relative to the region origin) covering every chunk the region can hold
+func _get_local_bounds() -> AABB:
+	var base_chunk := region_position * REGION_SIZE
+	var top := ChunkHeightZones.get_chunk_world_bounds(base_chunk + Vector3i(0, REGION_SIZE - 1, 0)).end.y
+	var origin := get_region_world_position()
+	var size_xz := float(REGION_SIZE * VoxelData.CHUNK_SIZE_XZ)
+	return AABB(Vector3.ZERO, Vector3(size_xz, top - origin.y, size_xz))
 
 ## Get the world position of this region's origin
-## NOTE: Regions span multiple Y heights, so Y position uses the min chunk Y
 func get_region_world_position() -> Vector3:
-	var world_x := float(region_position.x * REGION_SIZE * VoxelData.CHUNK_SIZE_XZ)
-	var world_z := float(region_position.z * REGION_SIZE * VoxelData.CHUNK_SIZE_XZ)
+	return region_world_position(region_position)
+
+## Get the world position of a region's origin
+## NOTE: Regions span multiple Y heights, so Y position uses the min chunk Y
+static func region_world_position(region_pos: Vector3i) -> Vector3:
+	var world_x := float(region_pos.x * REGION_SIZE * VoxelData.CHUNK_SIZE_XZ)
+	var world_z := float(region_pos.z * REGION_SIZE * VoxelData.CHUNK_SIZE_XZ)
 
 	# For Y, use the minimum chunk Y in this region
-	var min_chunk_y := region_position.y * REGION_SIZE
+	var min_chunk_y := region_pos.y * REGION_SIZE
 	var world_y := float(ChunkHeightZones.chunk_y_to_world_y(min_chunk_y))
 
 	return Vector3(world_x, world_y, world_z)
 
+## Offset from a chunk's region origin to the chunk origin
+## Chunk meshes for region batching are built with this offset so they upload as-is
+static func get_chunk_mesh_offset(chunk_pos: Vector3i) -> Vector3:
+	var chunk_origin := ChunkHeightZones.get_chunk_world_bounds(chunk_pos).position
+	return chunk_origin - region_world_position(chunk_to_region_position(chunk_pos))
+
 ## Get axis-aligned bounding box for this entire region
 ## CRITICAL: Must account for adaptive chunk heights!
 func get_aabb() -> AABB:
@@ -319,22 +273,31 @@ func cleanup() -> void:
 		mesh_instance.queue_free()
 		mesh_instance = null
 
+	if mesh_buffer:
+		mesh_buffer.clear()
+		mesh_buffer = null
+
+	if translucent_instance:
+		remove_child(translucent_instance)
+		translucent_instance.queue_free()
+		translucent_instance = null
+
+	if translucent_buffer:
+		translucent_buffer.clear()
+		translucent_buffer = null
+
 	chunks.clear()
 	chunk_count = 0
 	vertex_count = 0
 
-## Get memory usage estimate
+## Get memory usage estimate (the whole allocated buffer, including free slots)
 func get_memory_usage() -> int:
-	var total := 0
-
-	# Mesh data (approximate)
-	total += vertex_count * 12  # 3 floats per vertex
-	total += vertex_count * 12  # 3 floats per normal
-	total += vertex_count * 16  # 4 floats per color
-	total += vertex_count * 8   # 2 floats per UV
-	total += (vertex_count / 3) * 4  # Indices (assuming triangles)
-
-	return total
+	var bytes := 0
+	if mesh_buffer:
+		bytes += mesh_buffer.get_memory_usage()
+	if translucent_buffer:
+		bytes += translucent_buffer.get_memory_usage()
+	return bytes
 
 ## Debug: Print region info
 func print_info() -> void:
@@ -342,6 +305,16 @@ func print_info() -> void:
 	print("  Position: %s" % region_position)
 	print("  Chunks: %d / %d max" % [chunk_count, REGION_SIZE * REGION_SIZE * REGION_SIZE])
 	print("  Vertices: %d" % vertex_count)
-	print("  Dirty: %s" % is_dirty)
-	print("  Last rebuild: %.1f ms" % last_rebuild_time_ms)
+	if mesh_buffer:
+		var buffer_stats := mesh_buffer.get_stats()
+		print("  Slots: %d (%d / %d quads, %d free runs)" % [
+			buffer_stats.slots, buffer_stats.used_quads, buffer_stats.quad_capacity, buffer_stats.free_runs
+		])
+		print("  Compactions: %d, grows: %d" % [buffer_stats.compactions, buffer_stats.grows])
+	if translucent_buffer:
+		var translucent_stats := translucent_buffer.get_stats()
+		print("  Translucent slots: %d (%d / %d quads, %d reorders)" % [
+			translucent_stats.slots, translucent_stats.used_quads, translucent_stats.quad_capacity, translucent_stats.reorders
+		])
+	print("  Last upload: %.2f ms" % last_upload_time_ms)
 	print("  Memory: %.2f KB" % (get_memory_usage() / 1024.0))
@@ -0,0 +1,247 @@
+## ChunkSnapshot - Immutable voxel snapshot of a chunk and its 26 surrounding neighbors
+## Captured on the main thread when a meshing job is queued, so worker threads never
+## read live chunks (which the main thread may be editing or returning to the pool)
+##
+## Capture is cheap: voxel data and light are shared copy-on-write. The padded
+## (16+2) x (H+2) x (16+2) voxel and light buffers the mesher reads are built on the worker.
+class_name ChunkSnapshot
+extends RefCounted
+
+## Voxel type used for padding where a neighbor chunk isn't loaded
+## Missing neighbors are assumed solid so unloaded borders don't produce walls underground
+const MISSING_NEIGHBOR_FILL: int = VoxelTypes.Type.STONE
+
+## Chunk offsets of the edge (12) and corner (8) neighbors, whose border cells only feed
+## ambient occlusion; missing ones stay AIR (no darkening rather than false darkening)
+const DIAGONAL_OFFSETS: Array[Vector3i] = [
+	Vector3i(1, 0, 1), Vector3i(1, 0, -1), Vector3i(-1, 0, 1), Vector3i(-1, 0, -1),
+	Vector3i(1, 1, 0), Vector3i(1, -1, 0), Vector3i(-1, 1, 0), Vector3i(-1, -1, 0),
+	Vector3i(0, 1, 1), Vector3i(0, 1, -1), Vector3i(0, -1, 1), Vector3i(0, -1, -1),
+	Vector3i(1, 1, 1), Vector3i(1, 1, -1), Vector3i(1, -1, 1), Vector3i(1, -1, -1),
+	Vector3i(-1, 1, 1), Vector3i(-1, 1, -1), Vector3i(-1, -1, 1), Vector3i(-1, -1, -1)
+]
+
+## Chunk position in chunk coordinates
+var chunk_position: Vector3i = Vector3i.ZERO
+
+## Height of the snapshotted chunk
+var size_y: int = 16
+
+## Offset added to every mesh vertex (region-local origin for region batching)
+var mesh_offset: Vector3 = Vector3.ZERO
+
+## Snapshot of the chunk's own voxels
+var center: VoxelData = null
+
+## Snapshots of the six face neighbors (null where not loaded)
+var neighbors: Array[VoxelData] = [null, null, null, null, null, null]
+
+## Snapshots of the edge and corner neighbors (chunk offset -> VoxelData, loaded ones only)
+var diagonal_neighbors: Dictionary = {}
+
+## Light of the chunk and its six face neighbors (null where not lit; faces only ever
+## look into face-adjacent cells, so diagonal neighbors carry no light)
+var light: ChunkLight = null
+var neighbor_lights: Array[ChunkLight] = [null, null, null, null, null, null]
+
+## Partial remesh: a private copy of the chunk's cached quads and the X, Y and Z slice
+## masks to re-mesh and splice into it (null = mesh every slice)
+var quad_cache: ChunkQuadCache = null
+var slice_masks: PackedInt64Array = PackedInt64Array()
+
+## Capture a snapshot of a chunk and its neighbors (call on main thread)
+static func capture(chunk: Chunk, offset: Vector3 = Vector3.ZERO) -> ChunkSnapshot:
+	var snap := ChunkSnapshot.new()
+	snap.chunk_position = chunk.position
+	snap.mesh_offset = offset
+	snap.center = chunk.voxel_data.snapshot()
+	snap.size_y = snap.center.chunk_size_y
+	if chunk.light:
+		snap.light = chunk.light.snapshot()
+	if chunk.can_mesh_partially():
+		snap.quad_cache = chunk.quad_cache.duplicate_cache()
+		snap.slice_masks = chunk.dirty_slices
+
+	for i in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		var neighbor := chunk.get_neighbor(i)
+		if neighbor and neighbor.voxel_data:
+			snap.neighbors[i] = neighbor.voxel_data.snapshot()
+			if neighbor.light:
+				snap.neighbor_lights[i] = neighbor.light.snapshot()
+
+	for diagonal_offset in DIAGONAL_OFFSETS:
+		var diagonal := _find_neighbor(chunk, diagonal_offset)
+		if diagonal and diagonal.voxel_data:
+			snap.diagonal_neighbors[diagonal_offset] = diagonal.voxel_data.snapshot()
+
+	return snap
+
+## Walk face-neighbor links to the chunk at a diagonal offset
+## Tries every axis order, so one unloaded chunk on a path doesn't hide the target
+static func _find_neighbor(chunk: Chunk, offset: Vector3i) -> Chunk:
+	if offset == Vector3i.ZERO:
+		return chunk
+	for axis in range(3):
+		if offset[axis] == 0:
+			continue
+		# Face slots run positive then negative per axis
+		var next := chunk.get_neighbor(axis * 2 + (0 if offset[axis] > 0 else 1))
+		if not next:
+			continue
+		var step := Vector3i.ZERO
+		step[axis] = signi(offset[axis])
+		var found := _find_neighbor(next, offset - step)
+		if found:
+			return found
+	return null
+
+## Check if the snapshotted chunk has no voxels
+func is_empty() -> bool:
+	return center == null or center.is_empty()
+
+## Build the padded voxel buffer for BinaryGreedyMesher
+## The one-voxel border holds the boundary layers of the six face neighbors, plus the
+## edge/corner cells of the diagonal neighbors (read only for ambient occlusion)
+func build_padded() -> PackedByteArray:
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+
+	var padded := PackedByteArray()
+	padded.resize(BinaryGreedyMesher.padded_size(size_y))
+	padded.fill(VoxelTypes.Type.AIR)
+
+	# Chunk interior
+	if center.is_uniform:
+		if center.uniform_value != VoxelTypes.Type.AIR:
+			for y in range(size_y):
+				for z in range(size_xz):
+					var base := BinaryGreedyMesher.padded_index(0, y, z)
+					for x in range(size_xz):
+						padded[base + x] = center.uniform_value
+	else:
+		var flat := center.to_byte_array()
+		var flat_z_stride := size_xz * size_y
+		for y in range(size_y):
+			for z in range(size_xz):
+				var base := BinaryGreedyMesher.padded_index(0, y, z)
+				var src := y * size_xz + z * flat_z_stride
+				for x in range(size_xz):
+					padded[base + x] = flat[src + x]
+
+	# Horizontal neighbor borders (same chunk Y, so same height)
+	_copy_x_border(padded, neighbors[BinaryGreedyMesher.Face.POS_X], size_xz, 0)
+	_copy_x_border(padded, neighbors[BinaryGreedyMesher.Face.NEG_X], -1, size_xz - 1)
+	_copy_z_border(padded, neighbors[BinaryGreedyMesher.Face.POS_Z], size_xz, 0)
+	_copy_z_border(padded, neighbors[BinaryGreedyMesher.Face.NEG_Z], -1, size_xz - 1)
+
+	# Vertical neighbor borders (neighbors may have a different height)
+	var down: VoxelData = neighbors[BinaryGreedyMesher.Face.NEG_Y]
+	_copy_y_border(padded, neighbors[BinaryGreedyMesher.Face.POS_Y], size_y, 0)
+	_copy_y_border(padded, down, -1, down.chunk_size_y - 1 if down else 0)
+
+	# Edge and corner cells
+	for offset in diagonal_neighbors:
+		_copy_diagonal_border(padded, diagonal_neighbors[offset], offset)
+
+	return padded
+
+## Build the padded light buffer (baked 0-15 level per cell, same layout as build_padded)
+## Returns an empty buffer if the chunk isn't lit (the mesher then uses full light)
+## Borders toward missing neighbors stay dark - the voxel padding hides those faces anyway
+func build_padded_light() -> PackedByteArray:
+	if light == null:
+		return PackedByteArray()
+
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var padded := PackedByteArray()
+	padded.resize(BinaryGreedyMesher.padded_size(size_y))
+	padded.fill(0)
+
+	# Chunk interior
+	if not light.is_dark():
+		var z_stride := size_xz * size_y
+		for y in range(size_y):
+			for z in range(size_xz):
+				var base := BinaryGreedyMesher.padded_index(0, y, z)
+				var src := y * size_xz + z * z_stride
+				for x in range(size_xz):
+					padded[base + x] = light.get_level(src + x)
+
+	# Face neighbor borders
+	for face in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		if neighbor_lights[face] and not neighbor_lights[face].is_dark():
+			_copy_light_border(padded, face)
+
+	return padded
+
+## Copy a face neighbor's boundary light layer into the padded border on that side
+func _copy_light_border(padded: PackedByteArray, face: int) -> void:
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var neighbor_light := neighbor_lights[face]
+	var neighbor_size_y: int = neighbors[face].chunk_size_y
+	var vertical := face == BinaryGreedyMesher.Face.POS_Y or face == BinaryGreedyMesher.Face.NEG_Y
+	var rows := size_xz if vertical else size_y
+
+	for v in range(rows):
+		for u in range(size_xz):
+			var dst: Vector3i  # Border cell in chunk-local coordinates
+			var src: Vector3i  # The same cell in the neighbor
+			match face:
+				BinaryGreedyMesher.Face.POS_X:
+					dst = Vector3i(size_xz, v, u); src = Vector3i(0, v, u)
+				BinaryGreedyMesher.Face.NEG_X:
+					dst = Vector3i(-1, v, u); src = Vector3i(size_xz - 1, v, u)
+				BinaryGreedyMesher.Face.POS_Y:
+					dst = Vector3i(u, size_y, v); src = Vector3i(u, 0, v)
+				BinaryGreedyMesher.Face.NEG_Y:
+					dst = Vector3i(u, -1, v); src = Vector3i(u, neighbor_size_y - 1, v)
+				BinaryGreedyMesher.Face.POS_Z:
+					dst = Vector3i(u, v, size_xz); src = Vector3i(u, v, 0)
+				_:
+					dst = Vector3i(u, v, -1); src = Vector3i(u, v, size_xz - 1)
+			padded[BinaryGreedyMesher.padded_index(dst.x, dst.y, dst.z)] = \
+				neighbor_light.get_level(src.x + src.y * size_xz + src.z * size_xz * neighbor_size_y)
+
+## Copy the cells a diagonal neighbor contributes to the padded border
+## Per axis: offset -1 -> padded layer -1 from the neighbor's last layer,
+## +1 -> the layer past the chunk from the neighbor's first layer, 0 -> the full range
+func _copy_diagonal_border(padded: PackedByteArray, neighbor: VoxelData, offset: Vector3i) -> void:
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var x_range := _border_range(offset.x, size_xz, size_xz)
+	var y_range := _border_range(offset.y, size_y, neighbor.chunk_size_y)
+	var z_range := _border_range(offset.z, size_xz, size_xz)
+
+	for i in range(y_range.z):
+		for j in range(z_range.z):
+			for k in range(x_range.z):
+				var src := Vector3i(x_range.y + k, y_range.y + i, z_range.y + j)
+				padded[BinaryGreedyMesher.padded_index(x_range.x + k, y_range.x + i, z_range.x + j)] = \
+					neighbor.get_voxel(src)
+
+## Destination start, source start and length along one axis of a diagonal border
+static func _border_range(offset: int, size: int, neighbor_size: int) -> Vector3i:
+	if offset > 0:
+		return Vector3i(size, 0, 1)
+	if offset < 0:
+		return Vector3i(-1, neighbor_size - 1, 1)
+	return Vector3i(0, 0, size)
+
+## Copy the neighbor's X layer (at src_x) into padded column x = dst_x
+func _copy_x_border(padded: PackedByteArray, neighbor: VoxelData, dst_x: int, src_x: int) -> void:
+	for y in range(size_y):
+		for z in range(VoxelData.CHUNK_SIZE_XZ):
+			padded[BinaryGreedyMesher.padded_index(dst_x, y, z)] = \
+				neighbor.get_voxel(Vector3i(src_x, y, z)) if neighbor else MISSING_NEIGHBOR_FILL
+
+## Copy the neighbor's Z layer (at src_z) into padded row z = dst_z
+func _copy_z_border(padded: PackedByteArray, neighbor: VoxelData, dst_z: int, src_z: int) -> void:
+	for y in range(size_y):
+		var base := BinaryGreedyMesher.padded_index(0, y, dst_z)
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			padded[base + x] = neighbor.get_voxel(Vector3i(x, y, src_z)) if neighbor else MISSING_NEIGHBOR_FILL
+
+## Copy the neighbor's Y layer (at src_y) into padded layer y = dst_y
+func _copy_y_border(padded: PackedByteArray, neighbor: VoxelData, dst_y: int, src_y: int) -> void:
+	for z in range(VoxelData.CHUNK_SIZE_XZ):
+		var base := BinaryGreedyMesher.padded_index(0, dst_y, z)
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			padded[base + x] = neighbor.get_voxel(Vector3i(x, src_y, z)) if neighbor else MISSING_NEIGHBOR_FILL
@@ -0,0 +1,123 @@
+## ClipmapRing - One level of the far-terrain heightfield clipmap
+## A square window of (cells + 1)^2 height samples, spaced `spacing` blocks apart, kept in a
+## toroidal texture: when the window slides only the newly entered rows and columns are
+## sampled, every other texel stays where it is (the shader wraps lookups by wrap_offset)
+##
+## Texels are RGF: R = top surface Y (water columns at sea level), G = surface block type
+## The grid mesh is shared by all rings; far_terrain.gdshader displaces it from the texture
+class_name ClipmapRing
+extends RefCounted
+
+const FAR_TERRAIN_SHADER: Shader = preload("res://scripts/voxel_engine_v2/shaders/far_terrain.gdshader")
+
+## Ring index (0 = finest) and distance between samples in blocks
+var level: int = 0
+var spacing: int = 1
+
+## Window size in cells (samples per side = cells + 1)
+var cells: int = 64
+
+## Sample coordinates (world / spacing) of the window's minimum corner
+var sample_origin: Vector2i = Vector2i.ZERO
+
+## False until the whole window has been sampled once
+var is_filled: bool = false
+
+## Reusable buffer for one run of a row
+var _row_heights: PackedInt32Array = PackedInt32Array()
+
+## Toroidal height/type texture
+var image: Image = null
+var texture: ImageTexture = null
+
+## Per-ring material (uniforms differ per ring) and the instance drawing the shared grid
+var material: ShaderMaterial = null
+var mesh_instance: MeshInstance3D = null
+
+func _init(ring_level: int = 0, ring_spacing: int = 1, ring_cells: int = 64) -> void:
+	level = ring_level
+	spacing = ring_spacing
+	cells = ring_cells
+
+	var texture_size := cells + 1
+	image = Image.create(texture_size, texture_size, false, Image.FORMAT_RGF)
+	texture = ImageTexture.create_from_image(image)
+
+	material = ShaderMaterial.new()
+	material.shader = FAR_TERRAIN_SHADER
+	material.set_shader_parameter("heightmap", texture)
+	material.set_shader_parameter("grid_cells", cells)
+	material.set_shader_parameter("spacing", float(spacing))
+
+## Window origin for a player position: the center snaps to every second sample, so the
+## window's edges always land on the next coarser ring's sample grid
+func get_target_origin(player_position: Vector3) -> Vector2i:
+	var step := spacing * 2
+	var center := Vector2i(floori(player_position.x / step) * 2, floori(player_position.z / step) * 2)
+	return center - Vector2i(cells / 2, cells / 2)
+
+## World-space XZ rectangle covered by the window
+func get_world_rect() -> Rect2:
+	return Rect2(Vector2(sample_origin * spacing), Vector2(cells * spacing, cells * spacing))
+
+## Slide the window to a new origin, sampling only the texels that entered it
+## column_types caches TerrainGenerator.get_column_types surface types per height
+## Returns the number of samples taken
+func slide_to(target_origin: Vector2i, generator: TerrainGenerator, column_types: Dictionary) -> int:
+	var texture_size := cells + 1
+	var old_min := sample_origin
+	var old_max := sample_origin + Vector2i(cells, cells)
+	var sea_level := generator.get_sea_level()
+	var samples := 0
+
+	for sz in range(target_origin.y, target_origin.y + texture_size):
+		var ty := posmod(sz, texture_size)
+
+		# New rows are sampled whole, kept rows only in the columns that entered
+		var first_x := target_origin.x
+		var end_x := target_origin.x + texture_size
+		if is_filled and sz >= old_min.y and sz <= old_max.y:
+			if target_origin.x < old_min.x:
+				end_x = mini(old_min.x, end_x)
+			elif target_origin.x > old_min.x:
+				first_x = maxi(old_max.x + 1, first_x)
+			else:
+				continue
+		var run := end_x - first_x
+		generator.sample_heights(first_x * spacing, sz * spacing, run, 1, _row_heights, spacing)
+
+		for r in range(run):
+			var sx := first_x + r
+			var height: int = _row_heights[r]
+			var surface_type: int
+			if height < sea_level:
+				height = sea_level
+				surface_type = VoxelTypes.Type.WATER
+			else:
+				surface_type = column_types.get(height, -1)
+				if surface_type < 0:
+					surface_type = generator.get_column_types(height).x
+					column_types[height] = surface_type
+
+			# Top face of the surface voxel sits one block above its Y
+			image.set_pixel(posmod(sx, texture_size), ty, Color(height + 1, surface_type, 0.0))
+			samples += 1
+
+	sample_origin = target_origin
+	is_filled = true
+	texture.update(image)
+	material.set_shader_parameter("sample_origin", sample_origin)
+	material.set_shader_parameter("wrap_offset", Vector2i(posmod(sample_origin.x, texture_size), posmod(sample_origin.y, texture_size)))
+
+	if mesh_instance:
+		var rect := get_world_rect()
+		mesh_instance.custom_aabb = AABB(Vector3(rect.position.x, 0.0, rect.position.y), Vector3(rect.size.x, 256.0, rect.size.y))
+	return samples
+
+## Area covered by the next finer ring, skipped by this ring's fragments (empty for ring 0)
+func set_inner_rect(rect: Rect2) -> void:
+	material.set_shader_parameter("inner_rect", Vector4(rect.position.x, rect.position.y, rect.end.x, rect.end.y))
+
+## Horizontal disc (around the player) drawn by chunks and LOD tiles instead
+func set_hole(center: Vector3, radius: float) -> void:
+	material.set_shader_parameter("hole", Vector3(center.x, center.z, radius))
@@ -0,0 +1,132 @@
+## HeightTileCache - Sharded cache of 32x32 terrain height tiles shared by worker threads
+## A chunk column (16x16) always lies inside one tile, so every chunk of a vertical stack
+## - and its neighbors in the same tile - reuse one batched height computation
+##
+## Tiles are immutable once published: a reader takes a reference under its shard's mutex
+## (one short lock per tile, not per column) and then reads the heights without locking.
+## Evicted tiles stay alive for readers still holding them (RefCounted)
+## Tiles are sharded by position so workers rarely wait on each other; a full shard evicts
+## the tiles farthest from the focus (the player) instead of arbitrary keys
+class_name HeightTileCache
+extends RefCounted
+
+## Tile edge in columns (a multiple of the chunk size, so chunks never straddle tiles)
+const TILE_SIZE: int = 32
+const TILE_SHIFT: int = 5
+
+## Number of independently locked shards (power of two)
+const SHARD_COUNT: int = 8
+
+## Tiles per shard before eviction (8 shards x 32 tiles x 4 KB = 1 MB of heights)
+const MAX_TILES_PER_SHARD: int = 32
+
+## Eviction trims a full shard down to this many tiles
+const EVICT_TO_TILES: int = 24
+
+## Immutable heights of one tile (indexed x + z * TILE_SIZE)
+class HeightTile extends RefCounted:
+	var tile_pos: Vector2i = Vector2i.ZERO
+	var heights: PackedInt32Array = PackedInt32Array()
+
+## Per-shard tile maps (tile position -> HeightTile) and their mutexes
+var _shards: Array[Dictionary] = []
+var _shard_mutexes: Array[Mutex] = []
+
+## Tile the player is in (written by the main thread, read when evicting)
+var _focus_tile: Vector2i = Vector2i.ZERO
+
+## Statistics (updated under the shard mutexes)
+var stats_hits: int = 0
+var stats_misses: int = 0
+var stats_evictions: int = 0
+
+func _init() -> void:
+	for i in range(SHARD_COUNT):
+		_shards.append({})
+		_shard_mutexes.append(Mutex.new())
+
+## Tile containing a world column
+static func world_to_tile(world_x: int, world_z: int) -> Vector2i:
+	return Vector2i(world_x >> TILE_SHIFT, world_z >> TILE_SHIFT)
+
+## Get a tile, sampling and publishing it on a miss (thread-safe)
+## Two threads missing the same tile both sample it; the first to publish wins
+func get_tile(tile_pos: Vector2i, generator: TerrainGenerator) -> HeightTile:
+	var shard := _get_shard_index(tile_pos)
+	var mutex := _shard_mutexes[shard]
+
+	mutex.lock()
+	var tile: HeightTile = _shards[shard].get(tile_pos)
+	if tile:
+		stats_hits += 1
+	mutex.unlock()
+	if tile:
+		return tile
+
+	# Sample outside the lock - other readers of this shard are not blocked meanwhile
+	var sampled := HeightTile.new()
+	sampled.tile_pos = tile_pos
+	generator.sample_heights(tile_pos.x * TILE_SIZE, tile_pos.y * TILE_SIZE, TILE_SIZE, TILE_SIZE, sampled.heights)
+
+	mutex.lock()
+	tile = _shards[shard].get(tile_pos)
+	if not tile:
+		tile = sampled
+		_shards[shard][tile_pos] = tile
+		stats_misses += 1
+		if _shards[shard].size() > MAX_TILES_PER_SHARD:
+			_evict_farthest(_shards[shard])
+	mutex.unlock()
+	return tile
+
+## Height of one column (thread-safe)
+func get_height(world_x: int, world_z: int, generator: TerrainGenerator) -> int:
+	var tile := get_tile(world_to_tile(world_x, world_z), generator)
+	return tile.heights[(world_x & (TILE_SIZE - 1)) + (world_z & (TILE_SIZE - 1)) * TILE_SIZE]
+
+## Move the eviction focus (call when the player moves)
+func set_focus(world_position: Vector3) -> void:
+	_focus_tile = world_to_tile(floori(world_position.x), floori(world_position.z))
+
+## Drop every tile (e.g. after a seed change)
+func clear() -> void:
+	for shard in range(SHARD_COUNT):
+		_shard_mutexes[shard].lock()
+		_shards[shard].clear()
+		_shard_mutexes[shard].unlock()
+
+## Number of cached tiles
+func get_tile_count() -> int:
+	var count := 0
+	for shard in range(SHARD_COUNT):
+		_shard_mutexes[shard].lock()
+		count += _shards[shard].size()
+		_shard_mutexes[shard].unlock()
+	return count
+
+## Get cache statistics
+func get_stats() -> Dictionary:
+	var lookups := stats_hits + stats_misses
+	return {
+		"tiles": get_tile_count(),
+		"hits": stats_hits,
+		"misses": stats_misses,
+		"evictions": stats_evictions,
+		"hit_rate": (float(stats_hits) / lookups * 100.0) if lookups > 0 else 0.0
+	}
+
+## Shard of a tile position (spatial hash, so neighboring tiles land in different shards)
+func _get_shard_index(tile_pos: Vector2i) -> int:
+	return ((tile_pos.x * 73856093) ^ (tile_pos.y * 19349663)) & (SHARD_COUNT - 1)
+
+## Evict the tiles farthest from the focus until the shard is down to EVICT_TO_TILES
+## (caller holds the shard mutex)
+func _evict_farthest(shard: Dictionary) -> void:
+	var focus := _focus_tile
+	var by_distance := shard.keys()
+	by_distance.sort_custom(func(a: Vector2i, b: Vector2i) -> bool:
+		return (a - focus).length_squared() > (b - focus).length_squared())
+
+	for i in range(by_distance.size() - EVICT_TO_TILES):
+		shard.erase(by_distance[i])
+		stats_evictions += 1
@@ -0,0 +1,138 @@
+## LodTile - One distant-terrain tile meshed from a TerrainMip level
+## A tile is 16x16 cells of its level, so the padded buffer has the same layout as a chunk's
+## and goes through the same greedy mesher; the mesh instance is scaled by the cell size
+## (level 1 = 2 blocks per cell, 32-block tiles; level 3 = 8 blocks per cell, 128-block tiles)
+##
+## Seams between tiles of different levels are hidden with skirts: the padding ring is left
+## open for SKIRT_CELLS below each edge column's surface, so every edge column shows a short
+## wall that covers the crack to a lower neighbor (and is buried under a higher one)
+##
+## Chunk columns the full-resolution chunks already draw (covered_mask) are left empty, so the
+## tile never covers or z-fights the real terrain along the edge of the loaded chunk diamond
+class_name LodTile
+extends RefCounted
+
+## Tile size in cells (one chunk footprint at the tile's level)
+const TILE_CELLS: int = VoxelData.CHUNK_SIZE_XZ
+
+## Depth of the seam skirts below the edge surface, in cells
+const SKIRT_CELLS: int = 2
+
+## Tallest buffer the mesher can pack (7-bit quad coordinates)
+const MAX_SIZE_Y: int = 126
+
+## Mip level (1..TerrainMip.MAX_LEVEL) and tile coordinates on that level's grid
+var level: int = TerrainMip.MIN_LEVEL
+var tile_pos: Vector2i = Vector2i.ZERO
+
+## Chunk columns left empty, bit cx + cz * get_chunks_across() of the columns the tile spans
+var covered_mask: int = 0
+
+## Vertical extent in cells, known once the buffer is built
+var y_min_cell: int = 0
+var size_y: int = 0
+
+## Mesh instance (null until built, or if the tile has no geometry)
+var mesh_instance: MeshInstance3D = null
+var vertex_count: int = 0
+
+## Slot in ChunkManager's FrustumCuller bounds table (-1 = not registered)
+var cull_slot: int = -1
+
+func _init(tile_level: int = TerrainMip.MIN_LEVEL, pos: Vector2i = Vector2i.ZERO) -> void:
+	level = tile_level
+	tile_pos = pos
+
+## Dictionary key of a tile (LOD tiles of all levels share one map)
+static func make_key(tile_level: int, pos: Vector2i) -> Vector3i:
+	return Vector3i(pos.x, tile_level, pos.y)
+
+## Tile edge length in blocks at a level
+static func get_tile_size(tile_level: int) -> int:
+	return TILE_CELLS << tile_level
+
+## Blocks per cell
+func get_cell_size() -> int:
+	return 1 << level
+
+## Chunk columns across a tile at a level
+static func get_chunks_across(tile_level: int) -> int:
+	return get_tile_size(tile_level) / VoxelData.CHUNK_SIZE_XZ
+
+## World XZ of the tile's minimum corner
+func get_world_origin() -> Vector2i:
+	return tile_pos * get_tile_size(level)
+
+## World-space box of the built tile
+func get_aabb() -> AABB:
+	var origin := get_world_origin()
+	var cell := float(get_cell_size())
+	return AABB(
+		Vector3(origin.x, y_min_cell * cell, origin.y),
+		Vector3(TILE_CELLS * cell, size_y * cell, TILE_CELLS * cell)
+	)
+
+## Build the padded cell buffer for the mesher (thread-safe: reads only the generator)
+## Sets y_min_cell and size_y
+func build_padded(generator: TerrainGenerator) -> PackedByteArray:
+	var cell := get_cell_size()
+	var mip := TerrainMip.build(generator, get_world_origin(), TILE_CELLS * cell, level)
+	var heights: PackedInt32Array = mip.heights[level]
+	var surface: PackedByteArray = mip.surface_types[level]
+	var subsurface: PackedByteArray = mip.subsurface_types[level]
+
+	# A cell is water if at least half of its layers are at or below sea level
+	var water_top := floori(float(generator.get_sea_level() + 1 - cell / 2) / cell)
+
+	# Vertical extent: lowest skirt to highest surface (or water)
+	var min_height: int = heights[0]
+	var max_height: int = heights[0]
+	for height in heights:
+		min_height = mini(min_height, height)
+		max_height = maxi(max_height, height)
+	if min_height < water_top:
+		max_height = maxi(max_height, water_top)
+	y_min_cell = min_height - SKIRT_CELLS
+	size_y = mini(max_height - y_min_cell + 1, MAX_SIZE_Y)
+
+	var pad_xz := BinaryGreedyMesher.PAD_XZ
+	var pad_layer := BinaryGreedyMesher.PAD_LAYER
+	var padded := PackedByteArray()
+	padded.resize(BinaryGreedyMesher.padded_size(size_y))
+	var cells_per_chunk := VoxelData.CHUNK_SIZE_XZ / cell
+	var chunks_across := get_chunks_across(level)
+
+	for pz in range(pad_xz):
+		for px in range(pad_xz):
+			# Padding columns repeat the nearest edge column
+			var x := clampi(px - 1, 0, TILE_CELLS - 1)
+			var z := clampi(pz - 1, 0, TILE_CELLS - 1)
+			var i := x + z * TILE_CELLS
+			var border := px == 0 or pz == 0 or px == pad_xz - 1 or pz == pad_xz - 1
+
+			# Columns drawn by loaded chunks stay air, floor included (resize zero-fills)
+			if ((covered_mask >> (x / cells_per_chunk + (z / cells_per_chunk) * chunks_across)) & 1) != 0:
+				continue
+
+			var height: int = heights[i]
+			var skirt_top := height - SKIRT_CELLS if border else height + 1
+
+			for py in range(size_y + 2):
+				var c := y_min_cell + py - 1
+				var voxel_type: int = VoxelTypes.Type.AIR
+				if py == 0:
+					voxel_type = VoxelTypes.Type.STONE  # Solid floor: no bottom faces
+				elif c <= height:
+					if c >= skirt_top:
+						voxel_type = VoxelTypes.Type.AIR  # Open skirt beside the edge column
+					elif c == height:
+						voxel_type = surface[i]
+					elif c == height - 1:
+						voxel_type = subsurface[i]
+					else:
+						voxel_type = VoxelTypes.Type.STONE
+				elif c <= water_top:
+					voxel_type = VoxelTypes.Type.WATER
+				padded[px + pz * pad_xz + py * pad_layer] = voxel_type
+
+	return padded
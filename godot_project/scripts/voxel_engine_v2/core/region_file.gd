@@ -0,0 +1,226 @@
+## RegionFile - Anvil-style container storing many chunks in one file
+## Replaces one-file-per-chunk caching: a region covers 32x32 chunk columns and 8 chunk
+## levels, with a fixed header offset table and sector-aligned binary payloads
+##
+## File layout:
+##   Header: ENTRY_COUNT x u32 entries, each (sector_offset << 8) | sector_count (0 = absent)
+##   Payloads: start on SECTOR_SIZE boundaries, [u32 length][u8 codec][data...]
+##             (length counts the codec byte plus data)
+##
+## Loading a chunk is one seek + one read. Not thread-safe: use from one thread at a time.
+class_name RegionFile
+extends RefCounted
+
+## Region dimensions in chunks
+const REGION_SIZE_XZ: int = 32
+const REGION_SIZE_Y: int = 8  # Vertical bands keep the header small (adaptive zones span ~21 chunk levels)
+
+## Sector size in bytes (chunk payloads are small, so smaller than Anvil's 4 KB)
+const SECTOR_SIZE: int = 256
+
+## Header table
+const ENTRY_COUNT: int = REGION_SIZE_XZ * REGION_SIZE_XZ * REGION_SIZE_Y
+const HEADER_SECTORS: int = ENTRY_COUNT * 4 / SECTOR_SIZE
+
+## Payload prefix: u32 length + u8 codec
+const PAYLOAD_HEADER_SIZE: int = 5
+
+## Largest payload a single entry can address (255 sectors)
+const MAX_PAYLOAD_SIZE: int = 255 * SECTOR_SIZE - PAYLOAD_HEADER_SIZE
+
+## File extension for region files
+const FILE_EXTENSION: String = "vxr"
+
+## Path of this region file
+var path: String = ""
+
+## Open file handle (null when closed)
+var file: FileAccess = null
+
+## Cached header entries (index -> (sector_offset << 8) | sector_count)
+var entries: PackedInt64Array = PackedInt64Array()
+
+## Sector allocation map (1 = used), grows with the file
+var sector_used: PackedByteArray = PackedByteArray()
+
+## Get the region position containing a chunk
+static func region_position(chunk_pos: Vector3i) -> Vector3i:
+	# Arithmetic shifts floor negative coordinates correctly
+	return Vector3i(chunk_pos.x >> 5, chunk_pos.y >> 3, chunk_pos.z >> 5)
+
+## Get the header entry index of a chunk within its region
+static func entry_index(chunk_pos: Vector3i) -> int:
+	var lx := chunk_pos.x & (REGION_SIZE_XZ - 1)
+	var ly := chunk_pos.y & (REGION_SIZE_Y - 1)
+	var lz := chunk_pos.z & (REGION_SIZE_XZ - 1)
+	return lx + lz * REGION_SIZE_XZ + ly * REGION_SIZE_XZ * REGION_SIZE_XZ
+
+## Get the file name for a region position
+static func file_name_for(region_pos: Vector3i) -> String:
+	return "r.%d.%d.%d.%s" % [region_pos.x, region_pos.y, region_pos.z, FILE_EXTENSION]
+
+## Open (or create) a region file and load its header
+func open(file_path: String) -> Error:
+	path = file_path
+
+	if not FileAccess.file_exists(path):
+		# Create with an empty header
+		var created := FileAccess.open(path, FileAccess.WRITE)
+		if not created:
+			return FileAccess.get_open_error()
+		var empty_header := PackedByteArray()
+		empty_header.resize(HEADER_SECTORS * SECTOR_SIZE)
+		created.store_buffer(empty_header)
+		created.close()
+
+	file = FileAccess.open(path, FileAccess.READ_WRITE)
+	if not file:
+		return FileAccess.get_open_error()
+
+	# Load header table in one read
+	entries.resize(ENTRY_COUNT)
+	var header := file.get_buffer(HEADER_SECTORS * SECTOR_SIZE)
+	if header.size() < HEADER_SECTORS * SECTOR_SIZE:
+		header.resize(HEADER_SECTORS * SECTOR_SIZE)
+
+	var file_sectors := maxi(ceili(float(file.get_length()) / SECTOR_SIZE), HEADER_SECTORS)
+	sector_used.resize(file_sectors)
+	sector_used.fill(0)
+	for s in range(HEADER_SECTORS):
+		sector_used[s] = 1
+
+	for i in range(ENTRY_COUNT):
+		var entry := header.decode_u32(i * 4)
+		entries[i] = entry
+		if entry != 0:
+			var offset := entry >> 8
+			var count := entry & 0xFF
+			# Ignore entries pointing past the end (truncated file)
+			if offset + count > file_sectors:
+				entries[i] = 0
+				continue
+			for s in range(offset, offset + count):
+				sector_used[s] = 1
+
+	return OK
+
+## Close the file handle
+func close() -> void:
+	if file:
+		file.close()
+		file = null
+
+## Check if a chunk is stored in this region
+func has_chunk(chunk_pos: Vector3i) -> bool:
+	return entries.size() == ENTRY_COUNT and entries[entry_index(chunk_pos)] != 0
+
+## Read a chunk payload: returns [codec byte][data...] or empty if absent/corrupt
+func read_payload(chunk_pos: Vector3i) -> PackedByteArray:
+	if not file:
+		return PackedByteArray()
+
+	var entry: int = entries[entry_index(chunk_pos)]
+	if entry == 0:
+		return PackedByteArray()
+
+	file.seek((entry >> 8) * SECTOR_SIZE)
+	var sector_bytes := file.get_buffer((entry & 0xFF) * SECTOR_SIZE)
+	if sector_bytes.size() < PAYLOAD_HEADER_SIZE:
+		return PackedByteArray()
+
+	var length := sector_bytes.decode_u32(0)
+	if length == 0 or 4 + length > sector_bytes.size():
+		return PackedByteArray()
+
+	return sector_bytes.slice(4, 4 + length)
+
+## Write a chunk payload (codec byte + data), reusing its sectors in place when it fits
+func write_payload(chunk_pos: Vector3i, codec: int, data: PackedByteArray) -> bool:
+	if not file:
+		return false
+	if data.size() > MAX_PAYLOAD_SIZE:
+		push_error("[RegionFile] Payload for chunk %s too large (%d bytes)" % [chunk_pos, data.size()])
+		return false
+
+	var index := entry_index(chunk_pos)
+	var needed := ceili(float(data.size() + PAYLOAD_HEADER_SIZE) / SECTOR_SIZE)
+	var entry: int = entries[index]
+	var offset := entry >> 8
+	var count := entry & 0xFF
+
+	if entry != 0 and count >= needed:
+		# Fits in place - release any trailing sectors
+		for s in range(offset + needed, offset + count):
+			sector_used[s] = 0
+	else:
+		if entry != 0:
+			for s in range(offset, offset + count):
+				sector_used[s] = 0
+		offset = _allocate_sectors(needed)
+
+	# Sector-aligned payload: [u32 length][u8 codec][data][zero padding]
+	var buffer := PackedByteArray()
+	buffer.resize(PAYLOAD_HEADER_SIZE)
+	buffer.encode_u32(0, data.size() + 1)
+	buffer[4] = codec
+	buffer.append_array(data)
+	buffer.resize(needed * SECTOR_SIZE)
+
+	file.seek(offset * SECTOR_SIZE)
+	file.store_buffer(buffer)
+
+	# Update header entry
+	entries[index] = (offset << 8) | needed
+	file.seek(index * 4)
+	file.store_32(entries[index])
+
+	return true
+
+## Remove a chunk from the region (frees its sectors)
+func remove_chunk(chunk_pos: Vector3i) -> void:
+	if not file:
+		return
+	var index := entry_index(chunk_pos)
+	var entry: int = entries[index]
+	if entry == 0:
+		return
+	for s in range(entry >> 8, (entry >> 8) + (entry & 0xFF)):
+		sector_used[s] = 0
+	entries[index] = 0
+	file.seek(index * 4)
+	file.store_32(0)
+
+## Find a run of free sectors (first fit), growing the file if none is free
+func _allocate_sectors(count: int) -> int:
+	var run_start := -1
+	var run_length := 0
+	for s in range(HEADER_SECTORS, sector_used.size()):
+		if sector_used[s] == 0:
+			if run_length == 0:
+				run_start = s
+			run_length += 1
+			if run_length == count:
+				break
+		else:
+			run_length = 0
+
+	if run_length < count:
+		# Append (extend a trailing free run if there is one)
+		run_start = sector_used.size() - run_length if run_length > 0 else sector_used.size()
+		sector_used.resize(run_start + count)
+
+	for s in range(run_start, run_start + count):
+		sector_used[s] = 1
+	return run_start
+
+## Get the current file size in bytes
+func get_file_size() -> int:
+	return sector_used.size() * SECTOR_SIZE
+
+## Count chunks stored in this region
+func get_chunk_count() -> int:
+	var count := 0
+	for entry in entries:
+		if entry != 0:
+			count += 1
+	return count
@@ -0,0 +1,324 @@
+## RegionMeshBuffer - One sub-allocated mesh surface shared by all chunks of a ChunkRegion
+## Each chunk owns a contiguous run of quads in the surface (slot table: chunk_pos -> run),
+## so re-meshing one chunk uploads only that run with surface_update_*_region instead of
+## recombining and re-creating the whole region mesh
+##
+## Layout:
+##   - The surface holds quad_capacity quads (4 vertices each). Chunk arrays must be
+##     quad-ordered, as ChunkMeshBuilder emits them
+##   - The index buffer is built once per capacity (two triangles per quad) and never patched
+##   - Unused quads are zero-filled: all four vertices at the origin, so they rasterize nothing
+##   - Vertices use ChunkMeshBuilder's packed format (ChunkMeshBuilder.SURFACE_FORMAT_FLAGS),
+##     which encodes each chunk independently of the surface AABB
+##
+## Free runs are first-fit and merged with their neighbors. When no run is large enough the
+## slots are repacked (compaction) or, if the region is full, the capacity is doubled; both
+## upload every slot from its CPU-side copy in one write (only growing re-creates the surface).
+## The same repack reorders slots on request (reorder), which sets their draw order:
+## quads are drawn in buffer order, so translucent buffers keep their slots back-to-front.
+class_name RegionMeshBuffer
+extends RefCounted
+
+## Initial surface capacity in quads (grows by doubling)
+const INITIAL_QUAD_CAPACITY: int = 4096
+
+## Vertices and indices per quad
+const VERTICES_PER_QUAD: int = 4
+const INDICES_PER_QUAD: int = 6
+
+## The patched mesh (one surface)
+var mesh: ArrayMesh = ArrayMesh.new()
+
+## Capacity of the surface in quads
+var quad_capacity: int = 0
+
+## Quads owned by slots
+var used_quads: int = 0
+
+## Bytes per vertex in the vertex and attribute streams (measured from Godot's encoding)
+var vertex_stride: int = 0
+var attribute_stride: int = 0
+
+## Slot table (chunk_pos -> Vector2i(first_quad, quad_count))
+var slots: Dictionary = {}
+
+## Encoded stream bytes of each slot, kept for repacking (chunk_pos -> PackedByteArray)
+var _slot_vertex_data: Dictionary = {}
+var _slot_attribute_data: Dictionary = {}
+
+## Free runs as Vector2i(first_quad, quad_count), sorted by first_quad, never adjacent
+var _free_runs: Array[Vector2i] = []
+
+## Statistics
+var stats_uploads: int = 0
+var stats_upload_bytes: int = 0
+var stats_compactions: int = 0
+var stats_grows: int = 0
+var stats_reorders: int = 0
+
+## Create the buffer; bounds is the region-local box every chunk mesh fits in
+## (the surface itself only holds degenerate quads at first, so its AABB is set explicitly)
+func _init(bounds: AABB = AABB()) -> void:
+	mesh.custom_aabb = bounds
+	_measure_strides()
+	_create_surface(INITIAL_QUAD_CAPACITY)
+	_free_runs = [Vector2i(0, quad_capacity)]
+
+## Place (or replace) a chunk's mesh; empty arrays release the chunk's slot
+## Arrays are in region-local space. Returns the number of bytes uploaded
+func set_chunk(chunk_pos: Vector3i, arrays: Array) -> int:
+	if arrays.is_empty() or arrays[Mesh.ARRAY_VERTEX] == null or arrays[Mesh.ARRAY_VERTEX].is_empty():
+		return remove_chunk(chunk_pos)
+
+	# Indices are implied by the shared index buffer - encode the vertex streams only
+	var streams := arrays.duplicate()
+	streams[Mesh.ARRAY_INDEX] = null
+	var surface := RenderingServer.mesh_create_surface_data_from_arrays(
+		RenderingServer.PRIMITIVE_TRIANGLES, streams, [], {}, ChunkMeshBuilder.SURFACE_FORMAT_FLAGS)
+	var vertex_data: PackedByteArray = surface.vertex_data
+	var attribute_data: PackedByteArray = surface.attribute_data
+	var quad_count: int = surface.vertex_count / VERTICES_PER_QUAD
+
+	var bytes := 0
+	var run: Vector2i = slots.get(chunk_pos, Vector2i(-1, 0))
+	if run.x >= 0 and quad_count <= run.y:
+		# Fits in place - release the tail (its stale quads are cleared)
+		if quad_count < run.y:
+			bytes += _clear_quads(run.x + quad_count, run.y - quad_count)
+			_release_run(Vector2i(run.x + quad_count, run.y - quad_count))
+			used_quads -= run.y - quad_count
+		run.y = quad_count
+	else:
+		if run.x >= 0:
+			bytes += remove_chunk(chunk_pos)
+		var first := _allocate_run(quad_count)
+		if first < 0:
+			# Not enough contiguous space - repack (and grow if needed) with this chunk included
+			_slot_vertex_data[chunk_pos] = vertex_data
+			_slot_attribute_data[chunk_pos] = attribute_data
+			slots[chunk_pos] = Vector2i(-1, quad_count)
+			used_quads += quad_count
+			if used_quads <= quad_capacity:
+				stats_compactions += 1
+			return bytes + _repack(used_quads, _placed_order())
+		run = Vector2i(first, quad_count)
+		used_quads += quad_count
+
+	slots[chunk_pos] = run
+	_slot_vertex_data[chunk_pos] = vertex_data
+	_slot_attribute_data[chunk_pos] = attribute_data
+	return bytes + _upload(run.x, vertex_data, attribute_data)
+
+## Release a chunk's slot, returns the number of bytes uploaded to clear it
+func remove_chunk(chunk_pos: Vector3i) -> int:
+	if not slots.has(chunk_pos):
+		return 0
+	var run: Vector2i = slots[chunk_pos]
+	slots.erase(chunk_pos)
+	_slot_vertex_data.erase(chunk_pos)
+	_slot_attribute_data.erase(chunk_pos)
+	used_quads -= run.y
+	var bytes := _clear_quads(run.x, run.y)
+	_release_run(run)
+	return bytes
+
+## Repack the slots in the given chunk order (draw order follows buffer order)
+## Chunks without a slot are ignored, slots missing from order go last
+## Returns the number of bytes uploaded
+func reorder(order: Array) -> int:
+	if slots.is_empty():
+		return 0
+	var full_order: Array = []
+	for chunk_pos in order:
+		if slots.has(chunk_pos):
+			full_order.append(chunk_pos)
+	if full_order.size() < slots.size():
+		for chunk_pos in _placed_order():
+			if not full_order.has(chunk_pos):
+				full_order.append(chunk_pos)
+	stats_reorders += 1
+	return _repack(used_quads, full_order)
+
+## Check if a chunk has a slot
+func has_chunk(chunk_pos: Vector3i) -> bool:
+	return slots.has(chunk_pos)
+
+## Number of vertices owned by slots
+func get_vertex_count() -> int:
+	return used_quads * VERTICES_PER_QUAD
+
+## GPU memory of the surface (vertex + attribute streams + indices)
+func get_memory_usage() -> int:
+	var vertices := quad_capacity * VERTICES_PER_QUAD
+	var index_size := 2 if vertices <= 65536 else 4
+	return vertices * (vertex_stride + attribute_stride) + quad_capacity * INDICES_PER_QUAD * index_size
+
+## Get buffer statistics
+func get_stats() -> Dictionary:
+	return {
+		"slots": slots.size(),
+		"used_quads": used_quads,
+		"quad_capacity": quad_capacity,
+		"free_runs": _free_runs.size(),
+		"uploads": stats_uploads,
+		"upload_bytes": stats_upload_bytes,
+		"compactions": stats_compactions,
+		"grows": stats_grows,
+		"reorders": stats_reorders
+	}
+
+## Release the mesh
+func clear() -> void:
+	mesh.clear_surfaces()
+	slots.clear()
+	_slot_vertex_data.clear()
+	_slot_attribute_data.clear()
+	_free_runs.clear()
+	quad_capacity = 0
+	used_quads = 0
+
+## Upload a slot's encoded streams at its first quad
+func _upload(first_quad: int, vertex_data: PackedByteArray, attribute_data: PackedByteArray) -> int:
+	var first_vertex := first_quad * VERTICES_PER_QUAD
+	mesh.surface_update_vertex_region(0, first_vertex * vertex_stride, vertex_data)
+	if attribute_stride > 0:
+		mesh.surface_update_attribute_region(0, first_vertex * attribute_stride, attribute_data)
+	stats_uploads += 1
+	stats_upload_bytes += vertex_data.size() + attribute_data.size()
+	return vertex_data.size() + attribute_data.size()
+
+## Zero a quad range so it rasterizes nothing
+func _clear_quads(first_quad: int, quad_count: int) -> int:
+	var vertex_count := quad_count * VERTICES_PER_QUAD
+	var vertex_zeros := PackedByteArray()
+	vertex_zeros.resize(vertex_count * vertex_stride)
+	var attribute_zeros := PackedByteArray()
+	attribute_zeros.resize(vertex_count * attribute_stride)
+	return _upload(first_quad, vertex_zeros, attribute_zeros)
+
+## First-fit allocation, returns the first quad or -1 if no free run is large enough
+func _allocate_run(quad_count: int) -> int:
+	for i in range(_free_runs.size()):
+		var free_run := _free_runs[i]
+		if free_run.y < quad_count:
+			continue
+		if free_run.y == quad_count:
+			_free_runs.remove_at(i)
+		else:
+			_free_runs[i] = Vector2i(free_run.x + quad_count, free_run.y - quad_count)
+		return free_run.x
+	return -1
+
+## Return a run to the free list, merging it with adjacent free runs
+func _release_run(run: Vector2i) -> void:
+	if run.y <= 0:
+		return
+	var i := 0
+	while i < _free_runs.size() and _free_runs[i].x < run.x:
+		i += 1
+
+	# Merge with the previous run
+	if i > 0 and _free_runs[i - 1].x + _free_runs[i - 1].y == run.x:
+		i -= 1
+		run = Vector2i(_free_runs[i].x, _free_runs[i].y + run.y)
+		_free_runs.remove_at(i)
+
+	# Merge with the next run
+	if i < _free_runs.size() and run.x + run.y == _free_runs[i].x:
+		run.y += _free_runs[i].y
+		_free_runs.remove_at(i)
+
+	_free_runs.insert(i, run)
+
+## Slot chunk positions in buffer order; slots waiting for space go last
+func _placed_order() -> Array:
+	var order := slots.keys()
+	order.sort_custom(func(a, b):
+		var run_a: Vector2i = slots[a]
+		var run_b: Vector2i = slots[b]
+		if run_a.x < 0 or run_b.x < 0:
+			return run_b.x < 0 and run_a.x >= 0
+		return run_a.x < run_b.x)
+	return order
+
+## Pack every slot from quad 0 in the given order, growing the surface if needed
+## Uploads all slots in one write per stream; the surface is only re-created when it grows,
+## otherwise the quads past the packed slots are cleared in place
+func _repack(required_quads: int, order: Array) -> int:
+	var capacity := quad_capacity
+	while capacity < required_quads:
+		capacity *= 2
+
+	# End of the quads the old layout used (stale past the repacked slots)
+	var old_end := 0
+	for run in slots.values():
+		if run.x >= 0:
+			old_end = maxi(old_end, run.x + run.y)
+
+	var vertex_data := PackedByteArray()
+	var attribute_data := PackedByteArray()
+	var next_quad := 0
+	for chunk_pos in order:
+		var quad_count: int = slots[chunk_pos].y
+		slots[chunk_pos] = Vector2i(next_quad, quad_count)
+		vertex_data.append_array(_slot_vertex_data[chunk_pos])
+		attribute_data.append_array(_slot_attribute_data[chunk_pos])
+		next_quad += quad_count
+
+	var bytes := 0
+	if capacity != quad_capacity:
+		stats_grows += 1
+		_create_surface(capacity)
+	elif old_end > next_quad:
+		bytes += _clear_quads(next_quad, old_end - next_quad)
+
+	_free_runs.clear()
+	if next_quad < quad_capacity:
+		_free_runs.append(Vector2i(next_quad, quad_capacity - next_quad))
+
+	if next_quad == 0:
+		return bytes
+	return bytes + _upload(0, vertex_data, attribute_data)
+
+## (Re)create the surface with zero-filled streams and the fixed quad index pattern
+func _create_surface(capacity: int) -> void:
+	quad_capacity = capacity
+	var vertex_count := capacity * VERTICES_PER_QUAD
+
+	var vertices := PackedVector2Array()
+	var indices := PackedInt32Array()
+	vertices.resize(vertex_count)
+	indices.resize(capacity * INDICES_PER_QUAD)
+
+	# Two clockwise triangles per quad: (0, 1, 2) and (0, 2, 3)
+	for q in range(capacity):
+		var v := q * VERTICES_PER_QUAD
+		var i := q * INDICES_PER_QUAD
+		indices[i] = v
+		indices[i + 1] = v + 1
+		indices[i + 2] = v + 2
+		indices[i + 3] = v
+		indices[i + 4] = v + 2
+		indices[i + 5] = v + 3
+
+	var arrays: Array = []
+	arrays.resize(Mesh.ARRAY_MAX)
+	arrays[Mesh.ARRAY_VERTEX] = vertices
+	arrays[Mesh.ARRAY_INDEX] = indices
+
+	mesh.clear_surfaces()
+	mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, arrays, [], {}, ChunkMeshBuilder.SURFACE_FORMAT_FLAGS)
+
+## Measure the per-vertex stream strides by encoding one quad in the chunk vertex format
+func _measure_strides() -> void:
+	var vertices := PackedVector2Array()
+	vertices.resize(VERTICES_PER_QUAD)
+
+	var arrays: Array = []
+	arrays.resize(Mesh.ARRAY_MAX)
+	arrays[Mesh.ARRAY_VERTEX] = vertices
+
+	var surface := RenderingServer.mesh_create_surface_data_from_arrays(
+		RenderingServer.PRIMITIVE_TRIANGLES, arrays, [], {}, ChunkMeshBuilder.SURFACE_FORMAT_FLAGS)
+	vertex_stride = surface.vertex_data.size() / VERTICES_PER_QUAD
+	attribute_stride = surface.attribute_data.size() / VERTICES_PER_QUAD
@@ -0,0 +1,128 @@
+## TerrainMip - Downsampled voxel mip chain of a square terrain footprint (2x, 4x, 8x)
+## Generated terrain is a column of solid voxels under a surface height, so each mip level is
+## stored per column: the top solid cell plus the block types of its top two cells
+##
+## Level 0 is full resolution (one cell = one voxel). A cell of level L covers 2x2x2 cells of
+## level L-1 and is solid if at least 4 of those 8 are (majority filter, ties stay solid).
+## The parent column takes its surface types from its highest child column
+## (surface-preserving: grass stays on top instead of averaging into dirt or stone)
+##
+## Built on worker threads by LodTile; reads only the TerrainGenerator's stateless sampling
+class_name TerrainMip
+extends RefCounted
+
+## Finest LOD level (2x) and coarsest (8x)
+const MIN_LEVEL: int = 1
+const MAX_LEVEL: int = 3
+
+## World XZ of the footprint's minimum corner
+var origin: Vector2i = Vector2i.ZERO
+
+## Footprint size in voxels (level L is side >> L cells across)
+var side: int = 0
+
+## Per level: top solid cell index (cell c spans world Y c * 2^L .. c * 2^L + 2^L - 1),
+## indexed x + z * (side >> L)
+var heights: Array[PackedInt32Array] = []
+
+## Per level: block type of the top solid cell and of the cell below it
+var surface_types: Array[PackedByteArray] = []
+var subsurface_types: Array[PackedByteArray] = []
+
+## Sample a footprint from the generator and reduce it up to max_level
+static func build(generator: TerrainGenerator, footprint_origin: Vector2i, footprint_side: int, max_level: int) -> TerrainMip:
+	var mip := TerrainMip.new()
+	mip.origin = footprint_origin
+	mip.side = footprint_side
+	mip._sample_level_zero(generator)
+	for level in range(1, max_level + 1):
+		mip._reduce(level)
+	return mip
+
+## Number of cells across at a level
+func get_size(level: int) -> int:
+	return side >> level
+
+## Full-resolution columns straight from the generator (uncached - the footprint is sampled once)
+func _sample_level_zero(generator: TerrainGenerator) -> void:
+	var count := side * side
+	var level_heights := PackedInt32Array()
+	var level_surface := PackedByteArray()
+	var level_subsurface := PackedByteArray()
+	level_heights.resize(count)
+	level_surface.resize(count)
+	level_subsurface.resize(count)
+
+	generator.sample_heights(origin.x, origin.y, side, side, level_heights)
+
+	# Layer types depend only on the height - resolve each height once
+	var column_types := {}
+
+	for i in range(count):
+		var height: int = level_heights[i]
+		var types: Vector2i = column_types.get(height, Vector2i(-1, -1))
+		if types.x < 0:
+			types = generator.get_column_types(height)
+			column_types[height] = types
+		level_surface[i] = types.x
+		level_subsurface[i] = types.y
+
+	heights.append(level_heights)
+	surface_types.append(level_surface)
+	subsurface_types.append(level_subsurface)
+
+## Build a level from the one below it with the 2x2x2 majority filter
+func _reduce(level: int) -> void:
+	var child_size := get_size(level - 1)
+	var size := get_size(level)
+	var child_heights := heights[level - 1]
+	var child_surface := surface_types[level - 1]
+	var child_subsurface := subsurface_types[level - 1]
+
+	var level_heights := PackedInt32Array()
+	var level_surface := PackedByteArray()
+	var level_subsurface := PackedByteArray()
+	level_heights.resize(size * size)
+	level_surface.resize(size * size)
+	level_subsurface.resize(size * size)
+
+	for z in range(size):
+		for x in range(size):
+			var c0 := x * 2 + z * 2 * child_size
+			var c2 := c0 + child_size
+			var h0: int = child_heights[c0]
+			var h1: int = child_heights[c0 + 1]
+			var h2: int = child_heights[c2]
+			var h3: int = child_heights[c2 + 1]
+
+			# Highest child column supplies the surface types
+			var top := c0
+			var top_height := h0
+			if h1 > top_height:
+				top = c0 + 1; top_height = h1
+			if h2 > top_height:
+				top = c2; top_height = h2
+			if h3 > top_height:
+				top = c2 + 1; top_height = h3
+
+			# Parent cell p covers child cells 2p and 2p + 1; walk down from the highest
+			# candidate until at least half of the 8 children are solid
+			var parent := top_height >> 1
+			while _solid_children(h0, h1, h2, h3, parent) < 4:
+				parent -= 1
+
+			var i := x + z * size
+			level_heights[i] = parent
+			level_surface[i] = child_surface[top]
+			level_subsurface[i] = child_subsurface[top]
+
+	heights.append(level_heights)
+	surface_types.append(level_surface)
+	subsurface_types.append(level_subsurface)
+
+## Count solid child cells (of 8) in parent cell p, given the four child column heights
+static func _solid_children(h0: int, h1: int, h2: int, h3: int, parent: int) -> int:
+	var low := parent * 2
+	var high := low + 1
+	return (int(h0 >= low) + int(h0 >= high) + int(h1 >= low) + int(h1 >= high) +
+			int(h2 >= low) + int(h2 >= high) + int(h3 >= low) + int(h3 >= high))
@@ -1,7 +1,8 @@
-## VoxelData - Efficient voxel storage using PackedByteArray
+## VoxelData - Palette-compressed, bit-packed voxel storage
 ## Stores a 3D grid of voxels with adaptive height based on Y-level
-## Each voxel is 1 byte = 256 possible block types
-## Memory per chunk varies: 16x16x16 = 4KB, 16x16x64 = 16KB
+## Each chunk keeps a small palette of the block types it contains plus a
+## packed array of 1/2/4/8-bit palette indices (width grows only when needed)
+## Memory per chunk varies: 16x16x16 with 2 types = 512 bytes, 5 types = 2KB
 class_name VoxelData
 extends RefCounted
 
@@ -11,22 +12,51 @@ const CHUNK_SIZE_XZ: int = 16
 ## Legacy constant for backward compatibility
 const CHUNK_SIZE: int = CHUNK_SIZE_XZ
 
+## Maximum bits per palette index (8 bits = 256 block types)
+const MAX_BITS_PER_INDEX: int = 8
+
+## Batches of at least volume >> BULK_WRITE_SHIFT voxels are written through a flat array
+## (one palette rebuild) instead of voxel by voxel
+const BULK_WRITE_SHIFT: int = 4
+
+## Serialization format flags (first byte of serialized data)
+const FORMAT_RAW: int = 0      # Flat byte per voxel (legacy)
+const FORMAT_UNIFORM: int = 1  # Single value for the whole chunk
+const FORMAT_PALETTE: int = 2  # Palette + packed indices
+
 ## Chunk height (variable based on zone)
 var chunk_size_y: int = 16
 
-## Voxel data storage (4096 bytes per chunk)
-## Index formula: index = x + y * CHUNK_SIZE + z * CHUNK_SIZE * CHUNK_SIZE
-var data: PackedByteArray
+## Block types present in this chunk (palette index -> VoxelTypes.Type)
+## May contain stale entries after overwrites until compact() is called
+var palette: PackedByteArray
+
+## Packed palette indices, bits_per_index bits per voxel, never straddling bytes
+## Voxel index formula: index = x + y * CHUNK_SIZE_XZ + z * CHUNK_SIZE_XZ * chunk_size_y
+var indices: PackedByteArray
+
+## Current index width (1, 2, 4 or 8)
+var bits_per_index: int = 1
+
+## Cached bit math for the current width (avoids recomputing per access)
+var _entries_shift: int = 3  # log2(voxels per byte)
+var _entries_mask: int = 7   # voxels per byte - 1
+var _value_mask: int = 1     # (1 << bits_per_index) - 1
 
 ## Chunk position in chunk coordinates (not world coordinates)
 var chunk_position: Vector3i
 
 ## OPTIMIZATION: Uniform chunk optimization (Zylann technique)
-## If entire chunk has same value, store just that value instead of 4KB array
+## If entire chunk has same value, store just that value instead of a palette
 ## Saves massive memory for empty air chunks and solid stone chunks
 var is_uniform: bool = true
 var uniform_value: int = VoxelTypes.Type.AIR
 
+## Set by the generator for chunks with no visible faces whatever their neighbors hold
+## (buried stone and ore, deep water), so they can skip meshing; cleared by any edit
+## Not serialized - chunks loaded from the cache are meshed normally
+var is_enclosed: bool = false
+
 ## Initialize with all air (0)
 func _init(chunk_pos: Vector3i = Vector3i.ZERO) -> void:
 	chunk_position = chunk_pos
@@ -37,7 +67,7 @@ func _init(chunk_pos: Vector3i = Vector3i.ZERO) -> void:
 	# Start as uniform air chunk (no array allocation!)
 	is_uniform = true
 	uniform_value = VoxelTypes.Type.AIR
-	# data will be allocated lazily when first non-uniform write happens
+	# palette/indices will be allocated lazily when first non-uniform write happens
 
 ## Get voxel type at local position (0-15 on each axis)
 ## Returns VoxelTypes.Type enum value
@@ -49,8 +79,9 @@ func get_voxel(local_pos: Vector3i) -> int:
 	if is_uniform:
 		return uniform_value
 
-	var index := get_index(local_pos)
-	return data[index]
+	var index := local_pos.x + local_pos.y * CHUNK_SIZE_XZ + local_pos.z * CHUNK_SIZE_XZ * chunk_size_y
+	var palette_index := (indices[index >> _entries_shift] >> ((index & _entries_mask) * bits_per_index)) & _value_mask
+	return palette[palette_index]
 
 ## Set voxel type at local position (0-15 on each axis)
 func set_voxel(local_pos: Vector3i, voxel_type: int) -> void:
@@ -61,20 +92,80 @@ func set_voxel(local_pos: Vector3i, voxel_type: int) -> void:
 	if is_uniform:
 		if voxel_type == uniform_value:
 			return  # No change needed
-		# Need to expand to full array
+		# Need to expand to palette storage
 		_expand_uniform_chunk()
 
-	var index := get_index(local_pos)
-	data[index] = voxel_type
+	is_enclosed = false
+	_write_index(get_index(local_pos), _get_or_add_palette_index(voxel_type))
 
-## Expand a uniform chunk into a full array (called when first non-uniform write happens)
+## Expand a uniform chunk into palette storage (called when first non-uniform write happens)
 func _expand_uniform_chunk() -> void:
-	data = PackedByteArray()
-	var chunk_volume := get_chunk_volume()
-	data.resize(chunk_volume)
-	data.fill(uniform_value)
+	palette = PackedByteArray([uniform_value])
+	_set_bits_per_index(1)
+	indices = PackedByteArray()
+	indices.resize(get_chunk_volume() >> _entries_shift)
+	indices.fill(0)
 	is_uniform = false
 
+## Find a block type in the palette, adding it (and widening indices) if missing
+func _get_or_add_palette_index(voxel_type: int) -> int:
+	var palette_index := palette.find(voxel_type)
+	if palette_index != -1:
+		return palette_index
+
+	palette_index = palette.size()
+	if palette_index > _value_mask:
+		_repack(bits_per_index * 2)
+	palette.append(voxel_type)
+	return palette_index
+
+## Write a palette index for a voxel (caller guarantees non-uniform storage)
+func _write_index(index: int, palette_index: int) -> void:
+	var byte_index := index >> _entries_shift
+	var bit_offset := (index & _entries_mask) * bits_per_index
+	var packed := indices[byte_index] & ~(_value_mask << bit_offset)
+	indices[byte_index] = packed | (palette_index << bit_offset)
+
+## Update cached bit math for a new index width
+func _set_bits_per_index(bits: int) -> void:
+	bits_per_index = bits
+	_value_mask = (1 << bits) - 1
+	match bits:
+		1: _entries_shift = 3
+		2: _entries_shift = 2
+		4: _entries_shift = 1
+		_: _entries_shift = 0
+	_entries_mask = (1 << _entries_shift) - 1
+
+## Re-pack all indices at a different bit width (rare: at most 3 times per chunk)
+func _repack(new_bits: int) -> void:
+	var volume := get_chunk_volume()
+	var old_indices := indices
+	var old_shift := _entries_shift
+	var old_mask := _entries_mask
+	var old_bits := bits_per_index
+	var old_value_mask := _value_mask
+
+	_set_bits_per_index(mini(new_bits, MAX_BITS_PER_INDEX))
+	indices = PackedByteArray()
+	indices.resize(volume >> _entries_shift)
+	indices.fill(0)
+
+	for i in range(volume):
+		var value := (old_indices[i >> old_shift] >> ((i & old_mask) * old_bits)) & old_value_mask
+		if value != 0:
+			var byte_index := i >> _entries_shift
+			indices[byte_index] = indices[byte_index] | (value << ((i & _entries_mask) * bits_per_index))
+
+## Drop unused palette entries and shrink the index width to fit
+## Collapses back to a uniform chunk when only one block type remains
+func compact() -> void:
+	if is_uniform:
+		return
+
+	var flat := to_byte_array()
+	_load_from_flat(flat)
+
 ## Get total volume of this chunk (may vary based on height)
 func get_chunk_volume() -> int:
 	return CHUNK_SIZE_XZ * chunk_size_y * CHUNK_SIZE_XZ
@@ -115,17 +206,31 @@ func world_to_local(world_pos: Vector3i) -> Vector3i:
 	var local_z := world_pos.z - (chunk_position.z * CHUNK_SIZE_XZ)
 	return Vector3i(local_x, local_y, local_z)
 
+## Count voxels whose palette entry matches (or, with invert, does not match) a block type
+func _count_voxels_of_type(voxel_type: int, invert: bool = false) -> int:
+	var palette_index := palette.find(voxel_type)
+	var volume := get_chunk_volume()
+	if palette_index == -1:
+		return volume if invert else 0
+
+	var count := 0
+	for i in range(volume):
+		var value := (indices[i >> _entries_shift] >> ((i & _entries_mask) * bits_per_index)) & _value_mask
+		if value == palette_index:
+			count += 1
+	return volume - count if invert else count
+
 ## Check if the chunk is completely empty (all AIR)
 func is_empty() -> bool:
 	# OPTIMIZATION: O(1) check for uniform chunks
 	if is_uniform:
 		return uniform_value == VoxelTypes.Type.AIR
 
-	var volume := get_chunk_volume()
-	for i in range(volume):
-		if data[i] != VoxelTypes.Type.AIR:
-			return false
-	return true
+	# OPTIMIZATION: O(palette) check when AIR is not even in the palette
+	if palette.find(VoxelTypes.Type.AIR) == -1:
+		return false
+
+	return _count_voxels_of_type(VoxelTypes.Type.AIR, true) == 0
 
 ## Check if the chunk is completely solid (no AIR)
 func is_full() -> bool:
@@ -133,11 +238,11 @@ func is_full() -> bool:
 	if is_uniform:
 		return uniform_value != VoxelTypes.Type.AIR
 
-	var volume := get_chunk_volume()
-	for i in range(volume):
-		if data[i] == VoxelTypes.Type.AIR:
-			return false
-	return true
+	# OPTIMIZATION: O(palette) check when AIR is not in the palette
+	if palette.find(VoxelTypes.Type.AIR) == -1:
+		return true
+
+	return _count_voxels_of_type(VoxelTypes.Type.AIR) == 0
 
 ## Count non-air voxels in the chunk
 func count_solid_voxels() -> int:
@@ -146,20 +251,38 @@ func count_solid_voxels() -> int:
 		var volume := get_chunk_volume()
 		return 0 if uniform_value == VoxelTypes.Type.AIR else volume
 
-	var count := 0
-	var volume := get_chunk_volume()
-	for i in range(volume):
-		if data[i] != VoxelTypes.Type.AIR:
-			count += 1
-	return count
+	return _count_voxels_of_type(VoxelTypes.Type.AIR, true)
 
 ## Fill entire chunk with a specific voxel type
 func fill(voxel_type: int) -> void:
 	# OPTIMIZATION: Convert to uniform chunk
 	is_uniform = true
 	uniform_value = voxel_type
-	# Free the array to save memory
-	data = PackedByteArray()
+	# Free the arrays to save memory
+	palette = PackedByteArray()
+	indices = PackedByteArray()
+
+## Write many voxels by index (same order as get_index), returning their previous types
+## Large batches decode the chunk once, write the flat array and rebuild the palette once,
+## instead of growing and repacking the index array voxel by voxel
+func set_voxels(voxel_indices: PackedInt32Array, voxel_types: PackedByteArray) -> PackedByteArray:
+	var count := voxel_indices.size()
+	var old_types := PackedByteArray()
+	old_types.resize(count)
+
+	if count < get_chunk_volume() >> BULK_WRITE_SHIFT:
+		for i in range(count):
+			var local_pos := get_position_from_index(voxel_indices[i])
+			old_types[i] = get_voxel(local_pos)
+			set_voxel(local_pos, voxel_types[i])
+		return old_types
+
+	var flat := to_byte_array()
+	for i in range(count):
+		old_types[i] = flat[voxel_indices[i]]
+		flat[voxel_indices[i]] = voxel_types[i]
+	load_from_byte_array(flat)
+	return old_types
 
 ## Fill a rectangular region with a specific voxel type
 func fill_region(from_pos: Vector3i, to_pos: Vector3i, voxel_type: int) -> void:
@@ -177,32 +300,106 @@ func fill_region(from_pos: Vector3i, to_pos: Vector3i, voxel_type: int) -> void:
 				if is_position_valid(pos):
 					set_voxel(pos, voxel_type)
 
+## Decode into a flat byte-per-voxel array (same index order as get_index)
+## Used for bulk consumers (serialization fallback, compaction, snapshots)
+func to_byte_array() -> PackedByteArray:
+	var volume := get_chunk_volume()
+	var flat := PackedByteArray()
+	flat.resize(volume)
+
+	if is_uniform:
+		flat.fill(uniform_value)
+		return flat
+
+	for i in range(volume):
+		var value := (indices[i >> _entries_shift] >> ((i & _entries_mask) * bits_per_index)) & _value_mask
+		flat[i] = palette[value]
+	return flat
+
+## Replace the contents with a flat byte-per-voxel array (same index order as get_index)
+## Bulk writers (terrain generation) fill a flat buffer and build the palette once here
+## instead of growing it voxel by voxel through set_voxel
+func load_from_byte_array(flat: PackedByteArray) -> void:
+	is_enclosed = false
+	_load_from_flat(flat)
+
+## Rebuild palette storage from a flat byte-per-voxel array
+func _load_from_flat(flat: PackedByteArray) -> void:
+	var volume := get_chunk_volume()
+
+	# Build the palette first so the index width is chosen once
+	var new_palette := PackedByteArray()
+	var lookup := PackedInt32Array()
+	lookup.resize(256)
+	lookup.fill(-1)
+	for i in range(volume):
+		var voxel_type := flat[i]
+		if lookup[voxel_type] == -1:
+			lookup[voxel_type] = new_palette.size()
+			new_palette.append(voxel_type)
+
+	if new_palette.size() <= 1:
+		fill(new_palette[0] if new_palette.size() == 1 else VoxelTypes.Type.AIR)
+		return
+
+	var bits := 1
+	while (1 << bits) < new_palette.size():
+		bits *= 2
+
+	is_uniform = false
+	palette = new_palette
+	_set_bits_per_index(bits)
+	indices = PackedByteArray()
+	indices.resize(volume >> _entries_shift)
+	indices.fill(0)
+
+	for i in range(volume):
+		var value := lookup[flat[i]]
+		if value != 0:
+			var byte_index := i >> _entries_shift
+			indices[byte_index] = indices[byte_index] | (value << ((i & _entries_mask) * bits_per_index))
+
 ## Clone this voxel data (deep copy)
 func clone() -> VoxelData:
 	var cloned := VoxelData.new(chunk_position)
+	cloned.chunk_size_y = chunk_size_y
 	cloned.is_uniform = is_uniform
 	cloned.uniform_value = uniform_value
 	if not is_uniform:
-		cloned.data = data.duplicate()
+		cloned.palette = palette.duplicate()
+		cloned.indices = indices.duplicate()
+		cloned._set_bits_per_index(bits_per_index)
 	return cloned
 
+## Read-only snapshot of this voxel data (shallow copy)
+## Packed arrays are copy-on-write, so this is O(1): later writes to the original
+## copy its buffers and leave the snapshot untouched. Safe to hand to worker threads.
+func snapshot() -> VoxelData:
+	var snap := VoxelData.new(chunk_position)
+	snap.chunk_size_y = chunk_size_y
+	snap.is_uniform = is_uniform
+	snap.uniform_value = uniform_value
+	if not is_uniform:
+		snap.palette = palette
+		snap.indices = indices
+		snap._set_bits_per_index(bits_per_index)
+	return snap
+
 ## Serialize voxel data to bytes for saving/networking
+## Palette format: [FORMAT_PALETTE, bits_per_index, palette_size - 1, palette..., indices...]
 func serialize() -> PackedByteArray:
 	# OPTIMIZATION: For uniform chunks, store efficiently
 	if is_uniform:
 		var bytes := PackedByteArray()
 		bytes.resize(2)
-		bytes[0] = 1  # Uniform flag
+		bytes[0] = FORMAT_UNIFORM
 		bytes[1] = uniform_value
 		return bytes
 
-	# Non-uniform: prefix with flag + data
-	var chunk_volume := get_chunk_volume()
-	var bytes := PackedByteArray()
-	bytes.resize(1 + chunk_volume)
-	bytes[0] = 0  # Non-uniform flag
-	for i in range(chunk_volume):
-		bytes[i + 1] = data[i]
+	# Non-uniform: header + palette + packed indices (native array appends, no per-voxel loop)
+	var bytes := PackedByteArray([FORMAT_PALETTE, bits_per_index, palette.size() - 1])
+	bytes.append_array(palette)
+	bytes.append_array(indices)
 	return bytes
 
 ## Deserialize voxel data from bytes
@@ -210,21 +407,28 @@ static func deserialize(bytes: PackedByteArray, chunk_pos: Vector3i) -> VoxelDat
 	var voxel_data := VoxelData.new(chunk_pos)
 	var chunk_volume := voxel_data.get_chunk_volume()
 
-	if bytes.size() == 2 and bytes[0] == 1:
+	if bytes.size() == 2 and bytes[0] == FORMAT_UNIFORM:
 		# Uniform chunk
 		voxel_data.is_uniform = true
 		voxel_data.uniform_value = bytes[1]
-	elif bytes.size() == chunk_volume + 1 and bytes[0] == 0:
-		# Non-uniform chunk
-		voxel_data.is_uniform = false
-		voxel_data.data = PackedByteArray()
-		voxel_data.data.resize(chunk_volume)
-		for i in range(chunk_volume):
-			voxel_data.data[i] = bytes[i + 1]
+	elif bytes.size() >= 3 and bytes[0] == FORMAT_PALETTE:
+		# Palette chunk
+		var bits: int = bytes[1]
+		var palette_size: int = bytes[2] + 1
+		voxel_data._set_bits_per_index(bits)
+		var indices_size := chunk_volume >> voxel_data._entries_shift
+		if bytes.size() == 3 + palette_size + indices_size:
+			voxel_data.is_uniform = false
+			voxel_data.palette = bytes.slice(3, 3 + palette_size)
+			voxel_data.indices = bytes.slice(3 + palette_size)
+		else:
+			push_error("[VoxelData] Palette data size mismatch for chunk %s" % chunk_pos)
+	elif bytes.size() == chunk_volume + 1 and bytes[0] == FORMAT_RAW:
+		# Non-uniform chunk (flat byte-per-voxel format)
+		voxel_data._load_from_flat(bytes.slice(1))
 	elif bytes.size() == chunk_volume:
 		# Legacy format (no uniform flag)
-		voxel_data.is_uniform = false
-		voxel_data.data = bytes.duplicate()
+		voxel_data._load_from_flat(bytes)
 
 	return voxel_data
 
@@ -232,12 +436,14 @@ static func deserialize(bytes: PackedByteArray, chunk_pos: Vector3i) -> VoxelDat
 func get_memory_usage() -> int:
 	if is_uniform:
 		return 2  # Just the two flags
-	return data.size()
+	return palette.size() + indices.size()
 
 ## Debug: Print chunk info
 func print_info() -> void:
-	print("Chunk at %s: %d solid voxels, %d bytes" % [
+	print("Chunk at %s: %d solid voxels, %d bytes (%d-bit, %d palette entries)" % [
 		chunk_position,
 		count_solid_voxels(),
-		get_memory_usage()
+		get_memory_usage(),
+		bits_per_index if not is_uniform else 0,
+		palette.size() if not is_uniform else 1
 	])
@@ -46,6 +46,17 @@ class BlockProperties:
 static var _block_registry: Dictionary = {}
 static var _initialized: bool = false
 
+## Flat lookup: 1 if a block type is opaque (occludes neighbor faces), indexed by type ID
+## Built once in initialize() so hot loops avoid per-voxel dictionary lookups
+static var _opaque_table: PackedByteArray = PackedByteArray()
+
+## Flat lookup: 1 if a block type is drawn in the translucent pass (visible but not opaque:
+## liquids, glass, leaves), indexed by type ID
+static var _translucent_table: PackedByteArray = PackedByteArray()
+
+## Flat lookup: light emitted by a block type (0-15), indexed by type ID
+static var _light_table: PackedByteArray = PackedByteArray()
+
 ## Initialize the block registry with all block definitions
 static func initialize() -> void:
 	if _initialized:
@@ -162,6 +173,23 @@ static func initialize() -> void:
 	glass.drop_item = -1  # Breaks into nothing
 	_block_registry[Type.GLASS] = glass
 
+	_build_lookup_tables()
+
+## Build flat per-type lookup tables from the registry
+static func _build_lookup_tables() -> void:
+	_opaque_table.resize(256)
+	_opaque_table.fill(0)
+	_translucent_table.resize(256)
+	_translucent_table.fill(0)
+	_light_table.resize(256)
+	_light_table.fill(0)
+	for block_type in _block_registry:
+		_light_table[block_type] = _block_registry[block_type].light_level
+		if not _block_registry[block_type].is_transparent:
+			_opaque_table[block_type] = 1
+		elif block_type != Type.AIR:
+			_translucent_table[block_type] = 1
+
 ## Get block properties by type ID
 static func get_properties(block_type: int) -> BlockProperties:
 	if not _initialized:
@@ -181,6 +209,24 @@ static func is_solid(block_type: int) -> bool:
 static func is_transparent(block_type: int) -> bool:
 	return get_properties(block_type).is_transparent
 
+## Get the opaque lookup table (1 = opaque, 0 = air/transparent) for all 256 type IDs
+static func get_opaque_table() -> PackedByteArray:
+	if not _initialized:
+		initialize()
+	return _opaque_table
+
+## Get the translucent lookup table (1 = drawn in the translucent pass) for all 256 type IDs
+static func get_translucent_table() -> PackedByteArray:
+	if not _initialized:
+		initialize()
+	return _translucent_table
+
+## Get the emitted light lookup table (light_level per type ID) for all 256 type IDs
+static func get_light_table() -> PackedByteArray:
+	if not _initialized:
+		initialize()
+	return _light_table
+
 ## Check if a block type is a liquid
 static func is_liquid(block_type: int) -> bool:
 	return get_properties(block_type).is_liquid
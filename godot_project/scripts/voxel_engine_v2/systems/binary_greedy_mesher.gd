@@ -0,0 +1,612 @@
+## BinaryGreedyMesher - Bitmask greedy mesher for padded chunk voxel buffers
+## Replaces per-voxel face checks with row bitmasks: visible faces for 16 voxels
+## are derived with one shift/AND, and quads are merged with bit scans
+##
+## Input: padded voxel buffer of (16+2) x (H+2) x (16+2) bytes, where the one-voxel
+## border holds the neighboring chunks' boundary voxels
+## Output: packed quads (one int per quad, see pack layout below)
+##
+## Each face also gets classic 3-neighbor ambient occlusion per corner, read from the
+## occupancy rows in front of the face; only faces with identical AO signatures merge
+## An optional padded light buffer (same layout, one 0-15 level per cell) gives each face
+## the light of the cell in front of it; faces merge only with equal light as well
+##
+## Opaque blocks are meshed by mesh(); liquids, glass and leaves by mesh_translucent(),
+## whose quads go to a separate alpha-blended surface
+##
+## Both can mesh a subset of slices (partial remesh after an edit): slice masks hold one
+## bit per slice along X, Y and Z, and only faces lying in a set slice are emitted
+##
+## Row masks run along X (18 bits including padding) rather than along Y, because
+## sky chunks are 64 voxels tall and GDScript only has signed 64-bit integers
+class_name BinaryGreedyMesher
+extends RefCounted
+
+## Padded horizontal size (chunk + one voxel border on each side)
+const PAD_XZ: int = VoxelData.CHUNK_SIZE_XZ + 2
+
+## Padded layer size (one Y layer of the padded buffer)
+const PAD_LAYER: int = PAD_XZ * PAD_XZ
+
+## Bits 1..16 of a padded row (the chunk interior)
+const INTERIOR_MASK: int = ((1 << VoxelData.CHUNK_SIZE_XZ) - 1) << 1
+
+## Face directions (outward normal of the quad)
+enum Face {
+	POS_X,  # East
+	NEG_X,  # West
+	POS_Y,  # Top
+	NEG_Y,  # Bottom
+	POS_Z,  # North
+	NEG_Z   # South
+}
+
+## Outward normals per face
+const FACE_NORMALS: Array[Vector3] = [
+	Vector3.RIGHT, Vector3.LEFT, Vector3.UP, Vector3.DOWN, Vector3.BACK, Vector3.FORWARD
+]
+
+## Packed quad layout (7 bits per coordinate/extent field)
+## x, y, z: minimum voxel of the quad (chunk-local)
+## w: extent along the plane bit axis (X for Y/Z faces, Z for X faces)
+## h: extent along the plane row axis (Z for Y faces, Y for X/Z faces)
+const QUAD_X_SHIFT: int = 0
+const QUAD_Y_SHIFT: int = 7
+const QUAD_Z_SHIFT: int = 14
+const QUAD_FACE_SHIFT: int = 21
+const QUAD_W_SHIFT: int = 24
+const QUAD_H_SHIFT: int = 31
+const QUAD_TYPE_SHIFT: int = 38
+const QUAD_AO_SHIFT: int = 46
+const QUAD_LIGHT_SHIFT: int = 54
+const QUAD_FIELD_MASK: int = 0x7F
+
+## Face light used when no light buffer is given (LOD tiles, lighting disabled)
+const LIGHT_FULL: int = 15
+
+## Padded-buffer offset from a voxel to the cell in front of each face
+const FRONT_OFFSETS: PackedInt32Array = [1, -1, PAD_LAYER, -PAD_LAYER, PAD_XZ, -PAD_XZ]
+
+## AO signature: 2 bits per plane corner (0 = fully occluded, 3 = open), corner index
+## c = u + 2 * v where u/v are 0 at the min and 1 at the max of the plane bit/row axes
+const AO_OPEN: int = 3
+
+## AO signature with all four corners open
+const AO_SIGNATURE_OPEN: int = 0xFF
+
+## Face connectivity set: one bit per unordered pair of faces (15 pairs)
+## Bit set = some path of non-opaque cells inside the chunk joins the two faces
+const CONNECTIVITY_ALL: int = 0x7FFF
+const CONNECTIVITY_NONE: int = 0
+
+## Trailing-zero lookup for one byte (bit scans over row masks)
+static var _ctz_table: PackedByteArray = _build_ctz_table()
+
+static func _build_ctz_table() -> PackedByteArray:
+	var table := PackedByteArray()
+	table.resize(256)
+	table[0] = 8
+	for i in range(1, 256):
+		var count := 0
+		while ((i >> count) & 1) == 0:
+			count += 1
+		table[i] = count
+	return table
+
+## Count trailing zero bits (value must be non-zero)
+static func _ctz(value: int) -> int:
+	var count := 0
+	while (value & 0xFF) == 0:
+		value >>= 8
+		count += 8
+	return count + _ctz_table[value & 0xFF]
+
+## Index into a padded buffer for chunk-local coordinates (-1..16 horizontally, -1..H vertically)
+static func padded_index(x: int, y: int, z: int) -> int:
+	return (x + 1) + (z + 1) * PAD_XZ + (y + 1) * PAD_LAYER
+
+## Size of a padded buffer for a chunk of the given height
+static func padded_size(size_y: int) -> int:
+	return PAD_LAYER * (size_y + 2)
+
+## Mesh a padded voxel buffer into greedy-merged quads
+## light is an optional padded light buffer (empty = every face at LIGHT_FULL)
+## slice_masks limits the output to the faces in those X, Y and Z slices (empty = all)
+## Pure function: reads only the buffers, safe to call from any thread
+static func mesh(padded: PackedByteArray, size_y: int, light: PackedByteArray = PackedByteArray(),
+				 slice_masks: PackedInt64Array = PackedInt64Array()) -> PackedInt64Array:
+	var quads := PackedInt64Array()
+	var partial := not slice_masks.is_empty()
+	var opaque := VoxelTypes.get_opaque_table()
+	var has_light := not light.is_empty()
+
+	# Step 1: opaque occupancy rows, one 18-bit mask per padded (y, z) row
+	var row_count := PAD_XZ * (size_y + 2)
+	var rows := PackedInt64Array()
+	rows.resize(row_count)
+	var any_opaque := false
+	for r in range(row_count):
+		var base := r * PAD_XZ
+		var mask := 0
+		for px in range(PAD_XZ):
+			if opaque[padded[base + px]]:
+				mask |= 1 << px
+		rows[r] = mask
+		if mask & INTERIOR_MASK and r >= PAD_XZ and r < row_count - PAD_XZ:
+			any_opaque = true
+
+	if not any_opaque:
+		return quads
+
+	# Step 2: per-face bitmask planes keyed by (slice, block type)
+	# Each plane is an Array of row masks (Array is shared by reference, so in-place updates are cheap)
+	var planes: Array[Dictionary] = []
+	for face in range(6):
+		planes.append({})
+
+	for y in range(size_y):
+		for z in range(VoxelData.CHUNK_SIZE_XZ):
+			var r := (y + 1) * PAD_XZ + (z + 1)
+			var row: int = rows[r]
+			var interior := row & INTERIOR_MASK
+			if interior == 0:
+				continue
+
+			# Visible faces for all 16 voxels of this row at once
+			var face_masks := [
+				interior & ~(row >> 1),           # +X: neighbor at x + 1
+				interior & ~(row << 1),           # -X: neighbor at x - 1
+				interior & ~rows[r + PAD_XZ],     # +Y: row above
+				interior & ~rows[r - PAD_XZ],     # -Y: row below
+				interior & ~rows[r + 1],          # +Z: next row in this layer
+				interior & ~rows[r - 1]           # -Z: previous row in this layer
+			]
+			if partial and not _keep_dirty_slices(face_masks, slice_masks, y, z):
+				continue
+
+			var voxel_base := (y + 1) * PAD_LAYER + (z + 1) * PAD_XZ
+			for face in range(6):
+				var bits: int = face_masks[face]
+				while bits != 0:
+					var px := _ctz(bits)
+					bits &= bits - 1
+					var x := px - 1
+					var voxel_type: int = padded[voxel_base + px]
+					var ao := _face_ao(rows, face, x, y, z)
+					var face_light: int = light[voxel_base + px + FRONT_OFFSETS[face]] if has_light else LIGHT_FULL
+					_add_face_bit(planes[face], face, x, y, z, voxel_type, ao, face_light, size_y)
+
+	# Step 3: greedy merge each plane with bit scans
+	_merge_planes(quads, planes, size_y)
+	return quads
+
+## Mesh the translucent voxels (liquids, glass, leaves) of a padded buffer into a second quad list
+## A translucent face is visible unless the voxel in front is opaque or the same block type,
+## so water bodies only emit their surface and their faces against air or other blocks
+## (never the faces between water voxels). Translucent faces get no AO (open signature)
+## Pure function: reads only the buffers, safe to call from any thread
+static func mesh_translucent(padded: PackedByteArray, size_y: int, light: PackedByteArray = PackedByteArray(),
+							 slice_masks: PackedInt64Array = PackedInt64Array()) -> PackedInt64Array:
+	var quads := PackedInt64Array()
+	var partial := not slice_masks.is_empty()
+	var opaque := VoxelTypes.get_opaque_table()
+	var translucent := VoxelTypes.get_translucent_table()
+	var has_light := not light.is_empty()
+
+	# Step 1: opaque rows, rows of translucent cells, and the translucent types inside the chunk
+	var row_count := PAD_XZ * (size_y + 2)
+	var opaque_rows := PackedInt64Array()
+	var translucent_rows := PackedInt64Array()
+	opaque_rows.resize(row_count)
+	translucent_rows.resize(row_count)
+	var present_types := PackedByteArray()
+	present_types.resize(256)
+	var any_translucent := false
+	for r in range(row_count):
+		var base := r * PAD_XZ
+		var opaque_mask := 0
+		var translucent_mask := 0
+		for px in range(PAD_XZ):
+			var voxel_type: int = padded[base + px]
+			if opaque[voxel_type]:
+				opaque_mask |= 1 << px
+			elif translucent[voxel_type]:
+				translucent_mask |= 1 << px
+		opaque_rows[r] = opaque_mask
+		translucent_rows[r] = translucent_mask
+
+		var interior := translucent_mask & INTERIOR_MASK
+		if interior and r >= PAD_XZ and r < row_count - PAD_XZ:
+			any_translucent = true
+			while interior != 0:
+				present_types[padded[base + _ctz(interior)]] = 1
+				interior &= interior - 1
+
+	if not any_translucent:
+		return quads
+
+	var planes: Array[Dictionary] = []
+	for face in range(6):
+		planes.append({})
+
+	# Step 2: one pass per translucent type - same-type cells block faces like opaque ones
+	var same_rows := PackedInt64Array()
+	same_rows.resize(row_count)
+	for voxel_type in range(256):
+		if not present_types[voxel_type]:
+			continue
+
+		for r in range(row_count):
+			var candidates: int = translucent_rows[r]
+			var mask := 0
+			var base := r * PAD_XZ
+			while candidates != 0:
+				var px := _ctz(candidates)
+				candidates &= candidates - 1
+				if padded[base + px] == voxel_type:
+					mask |= 1 << px
+			same_rows[r] = mask
+
+		for y in range(size_y):
+			for z in range(VoxelData.CHUNK_SIZE_XZ):
+				var r := (y + 1) * PAD_XZ + (z + 1)
+				var row: int = same_rows[r]
+				var interior := row & INTERIOR_MASK
+				if interior == 0:
+					continue
+
+				# Face order as in mesh(): +X, -X, +Y, -Y, +Z, -Z
+				var blocked: int = opaque_rows[r] | row
+				var face_masks := [
+					interior & ~(blocked >> 1),
+					interior & ~(blocked << 1),
+					interior & ~(opaque_rows[r + PAD_XZ] | same_rows[r + PAD_XZ]),
+					interior & ~(opaque_rows[r - PAD_XZ] | same_rows[r - PAD_XZ]),
+					interior & ~(opaque_rows[r + 1] | same_rows[r + 1]),
+					interior & ~(opaque_rows[r - 1] | same_rows[r - 1])
+				]
+				if partial and not _keep_dirty_slices(face_masks, slice_masks, y, z):
+					continue
+
+				var voxel_base := (y + 1) * PAD_LAYER + (z + 1) * PAD_XZ
+				for face in range(6):
+					var bits: int = face_masks[face]
+					while bits != 0:
+						var px := _ctz(bits)
+						bits &= bits - 1
+						var face_light: int = light[voxel_base + px + FRONT_OFFSETS[face]] if has_light else LIGHT_FULL
+						_add_face_bit(planes[face], face, px - 1, y, z, voxel_type, AO_SIGNATURE_OPEN, face_light, size_y)
+
+	# Step 3: greedy merge, as for opaque faces
+	_merge_planes(quads, planes, size_y)
+	return quads
+
+## Clear the face bits of one (y, z) row that lie outside the dirty slices
+## X faces keep the bits of dirty X slices; Y and Z faces are all in slice y or z
+## Returns false if no face of the row is left
+static func _keep_dirty_slices(face_masks: Array, slice_masks: PackedInt64Array, y: int, z: int) -> bool:
+	var x_bits := (slice_masks[0] << 1) & INTERIOR_MASK
+	face_masks[Face.POS_X] = face_masks[Face.POS_X] & x_bits
+	face_masks[Face.NEG_X] = face_masks[Face.NEG_X] & x_bits
+	if ((slice_masks[1] >> y) & 1) == 0:
+		face_masks[Face.POS_Y] = 0
+		face_masks[Face.NEG_Y] = 0
+	if ((slice_masks[2] >> z) & 1) == 0:
+		face_masks[Face.POS_Z] = 0
+		face_masks[Face.NEG_Z] = 0
+	for face_bits in face_masks:
+		if face_bits != 0:
+			return true
+	return false
+
+## Greedy merge every (slice, type, AO, light) plane of the six faces into quads
+static func _merge_planes(quads: PackedInt64Array, planes: Array[Dictionary], size_y: int) -> void:
+	for face in range(6):
+		var n_rows := VoxelData.CHUNK_SIZE_XZ if face == Face.POS_Y or face == Face.NEG_Y else size_y
+		for plane_key in planes[face]:
+			var plane: Array = planes[face][plane_key]
+			_merge_plane(quads, plane, n_rows, face, plane_key & 0xFF, (plane_key >> 8) & 0xFF,
+						 (plane_key >> 16) & 0xFF, plane_key >> 24)
+
+## Compute the AO signature of one face from the opaque cells around the cell in front of it
+## Each corner darkens with its two side neighbors and the diagonal between them
+## (both sides solid = fully occluded, whatever the diagonal)
+static func _face_ao(rows: PackedInt64Array, face: int, x: int, y: int, z: int) -> int:
+	# Cell in front of the face, in padded coordinates
+	var fx := x + 1
+	var fy := y + 1
+	var fz := z + 1
+	match face:
+		Face.POS_X: fx += 1
+		Face.NEG_X: fx -= 1
+		Face.POS_Y: fy += 1
+		Face.NEG_Y: fy -= 1
+		Face.POS_Z: fz += 1
+		Face.NEG_Z: fz -= 1
+
+	var signature := 0
+	for c in range(4):
+		var su := 1 if c & 1 else -1
+		var sv := 1 if c & 2 else -1
+		var side_u: int
+		var side_v: int
+		var diagonal: int
+		match face:
+			Face.POS_Y, Face.NEG_Y:  # u = X, v = Z
+				side_u = (rows[fy * PAD_XZ + fz] >> (fx + su)) & 1
+				side_v = (rows[fy * PAD_XZ + fz + sv] >> fx) & 1
+				diagonal = (rows[fy * PAD_XZ + fz + sv] >> (fx + su)) & 1
+			Face.POS_Z, Face.NEG_Z:  # u = X, v = Y
+				side_u = (rows[fy * PAD_XZ + fz] >> (fx + su)) & 1
+				side_v = (rows[(fy + sv) * PAD_XZ + fz] >> fx) & 1
+				diagonal = (rows[(fy + sv) * PAD_XZ + fz] >> (fx + su)) & 1
+			_:  # u = Z, v = Y
+				side_u = (rows[fy * PAD_XZ + fz + su] >> fx) & 1
+				side_v = (rows[(fy + sv) * PAD_XZ + fz] >> fx) & 1
+				diagonal = (rows[(fy + sv) * PAD_XZ + fz + su] >> fx) & 1
+
+		var level := 0 if side_u and side_v else AO_OPEN - side_u - side_v - diagonal
+		signature |= level << (c * 2)
+	return signature
+
+## Record one visible face in its (slice, type, AO signature, light) plane
+## Plane axes: Y faces -> slice Y, rows Z, bits X
+##             Z faces -> slice Z, rows Y, bits X
+##             X faces -> slice X, rows Y, bits Z (transposed from the X-major row masks)
+static func _add_face_bit(face_planes: Dictionary, face: int, x: int, y: int, z: int,
+						  voxel_type: int, ao: int, light: int, size_y: int) -> void:
+	var slice: int
+	var row: int
+	var bit: int
+	var n_rows: int
+	match face:
+		Face.POS_Y, Face.NEG_Y:
+			slice = y; row = z; bit = x; n_rows = VoxelData.CHUNK_SIZE_XZ
+		Face.POS_Z, Face.NEG_Z:
+			slice = z; row = y; bit = x; n_rows = size_y
+		_:
+			slice = x; row = y; bit = z; n_rows = size_y
+
+	var plane_key := slice | (voxel_type << 8) | (ao << 16) | (light << 24)
+	var plane: Array = face_planes.get(plane_key, [])
+	if plane.is_empty():
+		plane.resize(n_rows)
+		plane.fill(0)
+		face_planes[plane_key] = plane
+	plane[row] = plane[row] | (1 << bit)
+
+## Greedily merge one bitmask plane into quads
+static func _merge_plane(quads: PackedInt64Array, plane: Array, n_rows: int, face: int,
+						 slice: int, voxel_type: int, ao: int, light: int) -> void:
+	for r in range(n_rows):
+		var bits: int = plane[r]
+		while bits != 0:
+			# Run of consecutive set bits starting at the lowest set bit
+			var start := _ctz(bits)
+			var run := _ctz(~(bits >> start))
+			var run_mask := ((1 << run) - 1) << start
+
+			# Extend the run over following rows while they contain the whole run
+			var height := 1
+			while r + height < n_rows and (plane[r + height] & run_mask) == run_mask:
+				plane[r + height] = plane[r + height] & ~run_mask
+				height += 1
+
+			bits &= ~run_mask
+			quads.append(_pack_quad(face, slice, r, start, run, height, voxel_type, ao, light))
+
+## Pack a merged quad from plane coordinates into a single int
+static func _pack_quad(face: int, slice: int, row: int, bit: int, width: int, height: int,
+					   voxel_type: int, ao: int, light: int) -> int:
+	var x: int
+	var y: int
+	var z: int
+	match face:
+		Face.POS_Y, Face.NEG_Y:
+			x = bit; y = slice; z = row
+		Face.POS_Z, Face.NEG_Z:
+			x = bit; y = row; z = slice
+		_:
+			x = slice; y = row; z = bit
+
+	return ((x << QUAD_X_SHIFT) | (y << QUAD_Y_SHIFT) | (z << QUAD_Z_SHIFT) |
+			(face << QUAD_FACE_SHIFT) | (width << QUAD_W_SHIFT) | (height << QUAD_H_SHIFT) |
+			(voxel_type << QUAD_TYPE_SHIFT) | (ao << QUAD_AO_SHIFT) | (light << QUAD_LIGHT_SHIFT))
+
+## Unpack helpers
+static func quad_position(quad: int) -> Vector3i:
+	return Vector3i(
+		(quad >> QUAD_X_SHIFT) & QUAD_FIELD_MASK,
+		(quad >> QUAD_Y_SHIFT) & QUAD_FIELD_MASK,
+		(quad >> QUAD_Z_SHIFT) & QUAD_FIELD_MASK
+	)
+
+static func quad_face(quad: int) -> int:
+	return (quad >> QUAD_FACE_SHIFT) & 0x7
+
+static func quad_width(quad: int) -> int:
+	return (quad >> QUAD_W_SHIFT) & QUAD_FIELD_MASK
+
+static func quad_height(quad: int) -> int:
+	return (quad >> QUAD_H_SHIFT) & QUAD_FIELD_MASK
+
+static func quad_type(quad: int) -> int:
+	return (quad >> QUAD_TYPE_SHIFT) & 0xFF
+
+static func quad_ao(quad: int) -> int:
+	return (quad >> QUAD_AO_SHIFT) & 0xFF
+
+static func quad_light(quad: int) -> int:
+	return (quad >> QUAD_LIGHT_SHIFT) & 0xF
+
+## Slice of a quad along its face axis (X for X faces, Y for Y faces, Z for Z faces)
+static func quad_slice(quad: int) -> int:
+	var axis_shift: int = [QUAD_X_SHIFT, QUAD_Y_SHIFT, QUAD_Z_SHIFT][quad_face(quad) >> 1]
+	return (quad >> axis_shift) & QUAD_FIELD_MASK
+
+## Get the AO level of each corner, in quad_corners order
+static func quad_corner_ao(quad: int) -> PackedByteArray:
+	var ao := quad_ao(quad)
+	var face := quad_face(quad)
+	# Plane corner indices of base, base + A, base + A + B, base + B (A/B swapped like quad_corners)
+	var order := [0, 2, 3, 1] if face == Face.NEG_Y or face == Face.POS_Z or face == Face.NEG_X else [0, 1, 3, 2]
+	var levels := PackedByteArray()
+	levels.resize(4)
+	for i in range(4):
+		levels[i] = (ao >> (order[i] * 2)) & 3
+	return levels
+
+## Get the four corners of a quad in Godot's clockwise front-face winding
+## Corner order: base, base + A, base + A + B, base + B (or A/B swapped to keep winding)
+static func quad_corners(quad: int) -> PackedVector3Array:
+	var face := quad_face(quad)
+	var base := Vector3(quad_position(quad))
+	var w := float(quad_width(quad))
+	var h := float(quad_height(quad))
+
+	# A = extent along the plane bit axis, B = extent along the plane row axis
+	var a: Vector3
+	var b: Vector3
+	match face:
+		Face.POS_Y, Face.NEG_Y:
+			a = Vector3(w, 0, 0); b = Vector3(0, 0, h)
+		Face.POS_Z, Face.NEG_Z:
+			a = Vector3(w, 0, 0); b = Vector3(0, h, 0)
+		_:
+			a = Vector3(0, 0, w); b = Vector3(0, h, 0)
+
+	# Positive faces sit on the far side of the voxel
+	match face:
+		Face.POS_X: base.x += 1.0
+		Face.POS_Y: base.y += 1.0
+		Face.POS_Z: base.z += 1.0
+
+	# Swap A/B where A x B points along the outward normal (winding must be clockwise from outside)
+	if face == Face.NEG_Y or face == Face.POS_Z or face == Face.NEG_X:
+		var tmp := a
+		a = b
+		b = tmp
+
+	return PackedVector3Array([base, base + a, base + a + b, base + b])
+
+## Bit index of an unordered face pair in a connectivity set
+static func connectivity_bit(face_a: int, face_b: int) -> int:
+	var a := mini(face_a, face_b)
+	var b := maxi(face_a, face_b)
+	return a * (11 - a) / 2 + (b - a - 1)
+
+## Check if two faces are connected in a connectivity set
+static func faces_connected(connectivity: int, face_a: int, face_b: int) -> bool:
+	return face_a != face_b and ((connectivity >> connectivity_bit(face_a, face_b)) & 1) == 1
+
+## Mask of faces (1 << Face) reachable from a face through the chunk
+static func connected_faces(connectivity: int, face: int) -> int:
+	var mask := 0
+	for other in range(6):
+		if faces_connected(connectivity, face, other):
+			mask |= 1 << other
+	return mask
+
+## Compute which chunk faces see each other through non-opaque cells (Sodium-style)
+## Flood-fills each connected component of non-opaque interior cells and records every
+## pair of chunk faces the component touches. Works on 16-bit X row masks: a component
+## spreads along runs within a row and into the four neighbouring (y, z) rows
+static func compute_connectivity(padded: PackedByteArray, size_y: int) -> int:
+	var opaque := VoxelTypes.get_opaque_table()
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var full_row := (1 << size_xz) - 1
+
+	# Non-opaque cells still unassigned to a component, one mask per (y, z) row
+	var open := PackedInt32Array()
+	open.resize(size_y * size_xz)
+	var open_rows := 0
+	var full_rows := 0
+	for y in range(size_y):
+		for z in range(size_xz):
+			var base := padded_index(0, y, z)
+			var mask := 0
+			for x in range(size_xz):
+				if not opaque[padded[base + x]]:
+					mask |= 1 << x
+			open[y * size_xz + z] = mask
+			if mask != 0:
+				open_rows += 1
+			if mask == full_row:
+				full_rows += 1
+
+	# Fully solid or fully open chunks need no flood fill
+	if open_rows == 0:
+		return CONNECTIVITY_NONE
+	if full_rows == open.size():
+		return CONNECTIVITY_ALL
+
+	var connectivity := CONNECTIVITY_NONE
+	var stack_rows := PackedInt32Array()
+	var stack_seeds := PackedInt32Array()
+
+	for start_row in range(open.size()):
+		while open[start_row] != 0:
+			# Seed a new component at the lowest open cell of this row
+			var start_mask: int = open[start_row]
+			stack_rows.append(start_row)
+			stack_seeds.append(start_mask & -start_mask)
+			var touched := 0
+
+			while not stack_rows.is_empty():
+				var row: int = stack_rows[stack_rows.size() - 1]
+				var seed: int = stack_seeds[stack_seeds.size() - 1]
+				stack_rows.resize(stack_rows.size() - 1)
+				stack_seeds.resize(stack_seeds.size() - 1)
+
+				# Grow the seed over the open runs it touches
+				var available: int = open[row]
+				var fill := seed & available
+				if fill == 0:
+					continue
+				while true:
+					var grown := (fill | (fill << 1) | (fill >> 1)) & available
+					if grown == fill:
+						break
+					fill = grown
+				open[row] = available & ~fill
+
+				var y := row / size_xz
+				var z := row % size_xz
+				if fill & 1:
+					touched |= 1 << Face.NEG_X
+				if fill & (1 << (size_xz - 1)):
+					touched |= 1 << Face.POS_X
+				if y == 0:
+					touched |= 1 << Face.NEG_Y
+				if y == size_y - 1:
+					touched |= 1 << Face.POS_Y
+				if z == 0:
+					touched |= 1 << Face.NEG_Z
+				if z == size_xz - 1:
+					touched |= 1 << Face.POS_Z
+
+				# Spread into neighbouring rows (cells directly above/below/beside)
+				if y > 0 and fill & open[row - size_xz]:
+					stack_rows.append(row - size_xz)
+					stack_seeds.append(fill)
+				if y < size_y - 1 and fill & open[row + size_xz]:
+					stack_rows.append(row + size_xz)
+					stack_seeds.append(fill)
+				if z > 0 and fill & open[row - 1]:
+					stack_rows.append(row - 1)
+					stack_seeds.append(fill)
+				if z < size_xz - 1 and fill & open[row + 1]:
+					stack_rows.append(row + 1)
+					stack_seeds.append(fill)
+
+			# Every pair of faces this component touches is connected
+			for a in range(6):
+				if touched & (1 << a):
+					for b in range(a + 1, 6):
+						if touched & (1 << b):
+							connectivity |= 1 << connectivity_bit(a, b)
+
+			if connectivity == CONNECTIVITY_ALL:
+				return connectivity
+
+	return connectivity
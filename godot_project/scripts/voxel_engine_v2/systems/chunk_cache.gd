@@ -1,26 +1,99 @@
 ## ChunkCache - Manages chunk serialization and disk caching
 ## Saves generated chunks to disk to avoid regeneration when revisiting areas
+## Chunks are stored as binary VoxelData payloads in RegionFile containers
+## (user://chunk_cache/<seed>/r.x.y.z.vxr), so a load is one seek and one read
+##
+## With async_io enabled, all region file access happens on a dedicated I/O thread:
+## request_load() queues a read (plus read-ahead of horizontal neighbors) and
+## poll_loaded() hands decoded chunks back; save_chunk() queues a voxel snapshot that the
+## I/O thread serializes, compresses and writes in region-sorted batches
 class_name ChunkCache
 extends RefCounted
 
+## Payload codecs (stored per chunk in the region file)
+## Compressed payloads are [u32 raw_size][compressed bytes] (decompression needs the size)
+const CODEC_RAW: int = 0     # VoxelData.serialize() bytes as-is
+const CODEC_FASTLZ: int = 1  # Fast codec (FastLZ, Godot's built-in LZ4-class compressor)
+const CODEC_ZSTD: int = 2    # Dense codec (Zstandard)
+
+## Payloads smaller than this are stored raw (uniform chunks serialize to 2 bytes)
+const MIN_COMPRESS_SIZE: int = 64
+
+## Maximum region files kept open at once (least recently used are closed first)
+const MAX_OPEN_REGIONS: int = 16
+
+## Horizontal neighbors read ahead alongside a requested chunk (players mostly move in XZ)
+const READ_AHEAD_OFFSETS: Array[Vector3i] = [
+	Vector3i(1, 0, 0), Vector3i(-1, 0, 0), Vector3i(0, 0, 1), Vector3i(0, 0, -1)
+]
+
 ## Cache configuration
 var cache_enabled: bool = true
 var cache_directory: String = "user://chunk_cache/"
 var world_seed: int = 0
 var max_cache_size_mb: int = 500  # Maximum cache size in megabytes
 
+## Codec for newly saved chunks (CODEC_RAW, CODEC_FASTLZ or CODEC_ZSTD)
+var compression_codec: int = CODEC_ZSTD
+
+## In-memory cold tier: compressed payloads of recently saved/loaded chunks
+## Revisited chunks skip disk entirely; evicted least-recently-used first
+var memory_tier_limit_mb: float = 32.0
+
 ## Statistics
 var cache_hits: int = 0
 var cache_misses: int = 0
 var chunks_saved: int = 0
 var chunks_loaded: int = 0
-
-func _init(seed: int = 0, enabled: bool = true) -> void:
+var memory_tier_hits: int = 0
+var bytes_raw: int = 0          # Serialized bytes before compression (saved chunks)
+var bytes_compressed: int = 0   # Stored payload bytes (saved chunks)
+
+## Memory tier (Vector3i chunk_pos -> payload [codec][data]), in least-recently-used order
+var _memory_tier: Dictionary = {}
+var _memory_tier_bytes: int = 0
+
+## Open region files (Vector3i region_pos -> RegionFile), in least-recently-used order
+## Guarded by _region_mutex (owned by the I/O thread in async mode)
+var _open_regions: Dictionary = {}
+var _region_mutex: Mutex = Mutex.new()
+
+## Size index: on-disk bytes per region (Vector3i region_pos -> int) and their total
+## Built by one directory scan, then updated incrementally on every write
+var _region_sizes: Dictionary = {}
+var _size_bytes: int = 0
+var _size_index_ready: bool = false
+
+## Asynchronous I/O stage
+var async_io: bool = false
+var _io_thread: Thread = null
+var _io_semaphore: Semaphore = Semaphore.new()
+var _io_mutex: Mutex = Mutex.new()  # Guards the request/result queues and the size index
+var _io_exit: bool = false
+
+## I/O requests (main thread -> I/O thread)
+var _load_requests: Array[Vector3i] = []
+var _prefetch_requests: Dictionary = {}  # Vector3i -> true (read-ahead, payload only)
+var _save_requests: Dictionary = {}  # Vector3i -> VoxelData snapshot (repeat saves coalesce)
+
+## I/O results (I/O thread -> main thread)
+var _load_results: Array[Dictionary] = []  # {chunk_pos, chunk (null on miss), payload}
+var _prefetch_results: Dictionary = {}  # Vector3i -> payload
+var _saved_payloads: Array[Dictionary] = []  # {chunk_pos, payload, raw_size}
+
+## Loads requested but not yet polled (main thread only)
+var _pending_loads: Dictionary = {}
+
+func _init(seed: int = 0, enabled: bool = true, use_io_thread: bool = false) -> void:
 	world_seed = seed
 	cache_enabled = enabled
+	async_io = use_io_thread
 
 	if cache_enabled:
+		_size_index_ready = false
 		_ensure_cache_directory()
+		if async_io:
+			_start_io_thread()
 
 ## Ensure cache directory exists
 func _ensure_cache_directory() -> void:
@@ -37,114 +110,498 @@ func _ensure_cache_directory() -> void:
 		print("[ChunkCache] ERROR: Failed to access user:// directory")
 		cache_enabled = false
 
-## Get cache file path for a chunk
-func _get_cache_path(chunk_pos: Vector3i) -> String:
+## Get the seed-specific cache directory
+func _get_seed_directory() -> String:
 	# Include world seed in path to invalidate cache when seed changes
-	var seed_dir := "%s%d/" % [cache_directory, world_seed]
-	var filename := "%d_%d_%d.chunk" % [chunk_pos.x, chunk_pos.y, chunk_pos.z]
-	return seed_dir + filename
+	return "%s%d/" % [cache_directory, world_seed]
+
+## Get region file path for a region position
+func _get_region_path(region_pos: Vector3i) -> String:
+	return _get_seed_directory() + RegionFile.file_name_for(region_pos)
+
+## Get the region file for a chunk, opening it if needed
+## Returns null if the region doesn't exist on disk and create is false
+## Caller must hold _region_mutex
+func _get_region(chunk_pos: Vector3i, create: bool) -> RegionFile:
+	var region_pos := RegionFile.region_position(chunk_pos)
+
+	if _open_regions.has(region_pos):
+		# Move to back (most recently used)
+		var region: RegionFile = _open_regions[region_pos]
+		_open_regions.erase(region_pos)
+		_open_regions[region_pos] = region
+		return region
+
+	var region_path := _get_region_path(region_pos)
+	if not create and not FileAccess.file_exists(region_path):
+		return null
+
+	if create:
+		_ensure_seed_directory()
+
+	var region := RegionFile.new()
+	var error := region.open(region_path)
+	if error != OK:
+		print("[ChunkCache] ERROR: Failed to open region file %s: %d" % [region_path, error])
+		return null
+
+	# Close least recently used region if too many are open
+	if _open_regions.size() >= MAX_OPEN_REGIONS:
+		var oldest_pos = _open_regions.keys()[0]
+		_open_regions[oldest_pos].close()
+		_open_regions.erase(oldest_pos)
+
+	_open_regions[region_pos] = region
+	return region
+
+## Ensure seed-specific directory exists
+func _ensure_seed_directory() -> void:
+	var dir := DirAccess.open(cache_directory)
+	if dir and not dir.dir_exists(str(world_seed)):
+		dir.make_dir(str(world_seed))
+
+## Stop the I/O thread (flushing queued saves) and close all open region files
+func close() -> void:
+	_stop_io_thread()
+	_drain_saved_payloads()
+
+	_region_mutex.lock()
+	for region in _open_regions.values():
+		region.close()
+	_open_regions.clear()
+	_region_mutex.unlock()
 
 ## Check if a chunk is cached
+## In async mode this only consults memory (memory tier and queued saves) - use request_load
 func has_cached_chunk(chunk_pos: Vector3i) -> bool:
 	if not cache_enabled:
 		return false
 
-	var cache_path := _get_cache_path(chunk_pos)
-	return FileAccess.file_exists(cache_path)
+	if _memory_tier.has(chunk_pos) or _has_pending_save(chunk_pos):
+		return true
 
-## Load a chunk from cache
-func load_chunk(chunk_pos: Vector3i) -> Chunk:
-	if not cache_enabled:
-		cache_misses += 1
-		return null
-
-	var cache_path := _get_cache_path(chunk_pos)
-
-	if not FileAccess.file_exists(cache_path):
-		cache_misses += 1
-		return null
-
-	var file := FileAccess.open(cache_path, FileAccess.READ)
-	if not file:
-		print("[ChunkCache] ERROR: Failed to open cache file: %s" % cache_path)
-		cache_misses += 1
-		return null
+	if async_io:
+		return false
 
-	# Read chunk data
-	var data_json := file.get_as_text()
-	file.close()
+	_region_mutex.lock()
+	var region := _get_region(chunk_pos, false)
+	var found := region != null and region.has_chunk(chunk_pos)
+	_region_mutex.unlock()
+	return found
 
-	# Parse JSON
-	var json := JSON.new()
-	var parse_result := json.parse(data_json)
-	if parse_result != OK:
-		print("[ChunkCache] ERROR: Failed to parse chunk data: %s" % json.get_error_message())
+## Load a chunk from cache (blocking)
+## In async mode this only consults memory (memory tier and queued saves) - use request_load
+func load_chunk(chunk_pos: Vector3i) -> Chunk:
+	if not cache_enabled:
 		cache_misses += 1
 		return null
 
-	var data: Dictionary = json.data
+	var pending := _chunk_from_pending_save(chunk_pos)
+	if pending:
+		cache_hits += 1
+		chunks_loaded += 1
+		return pending
+
+	var payload: PackedByteArray
+	if _memory_tier.has(chunk_pos):
+		# Memory tier hit - no disk access
+		payload = _memory_tier[chunk_pos]
+		_memory_tier_touch(chunk_pos, payload)
+		memory_tier_hits += 1
+	else:
+		if async_io:
+			cache_misses += 1
+			return null
 
-	# Convert voxel_data array back to PackedByteArray if needed
-	if data.has("voxel_data") and data.voxel_data is Array:
-		var byte_array := PackedByteArray()
-		byte_array.resize(data.voxel_data.size())
-		for i in range(data.voxel_data.size()):
-			byte_array[i] = data.voxel_data[i]
-		data.voxel_data = byte_array
+		payload = _read_payload(chunk_pos)
+		if payload.is_empty():
+			cache_misses += 1
+			return null
+		_memory_tier_store(chunk_pos, payload)
 
-	# Deserialize chunk
-	var chunk := Chunk.deserialize(data)
+	var chunk := _decode_chunk(chunk_pos, payload)
 	if chunk:
 		cache_hits += 1
 		chunks_loaded += 1
-		return chunk
 	else:
 		cache_misses += 1
-		return null
+	return chunk
 
-## Save a chunk to cache
-func save_chunk(chunk: Chunk) -> bool:
-	if not cache_enabled or not chunk:
+## Request a chunk load without blocking (results arrive through poll_loaded)
+## Memory tier and queued-save hits are answered on the next poll without touching disk
+## Returns false if the cache can't serve loads (disabled)
+func request_load(chunk_pos: Vector3i) -> bool:
+	if not cache_enabled:
 		return false
 
-	# Ensure seed-specific directory exists
-	var seed_dir := "%s%d/" % [cache_directory, world_seed]
-	var dir := DirAccess.open(cache_directory)
-	if dir and not dir.dir_exists(str(world_seed)):
-		dir.make_dir(str(world_seed))
+	if not async_io:
+		# No I/O thread - answer immediately so callers use one code path
+		_pending_loads[chunk_pos] = true
+		_load_results.append({"chunk_pos": chunk_pos, "chunk": load_chunk(chunk_pos), "payload": PackedByteArray()})
+		return true
+
+	if _pending_loads.has(chunk_pos):
+		return true
+	_pending_loads[chunk_pos] = true
 
-	var cache_path := _get_cache_path(chunk.position)
+	_ensure_io_thread()
+	_drain_saved_payloads()
 
-	# Serialize chunk
-	var data := chunk.serialize()
+	# Answer from memory when possible (queued save first - it is newer than any payload)
+	var chunk := _chunk_from_pending_save(chunk_pos)
+	if not chunk and _memory_tier.has(chunk_pos):
+		var payload: PackedByteArray = _memory_tier[chunk_pos]
+		_memory_tier_touch(chunk_pos, payload)
+		memory_tier_hits += 1
+		chunk = _decode_chunk(chunk_pos, payload)
+
+	if chunk:
+		_io_mutex.lock()
+		_load_results.append({"chunk_pos": chunk_pos, "chunk": chunk, "payload": PackedByteArray()})
+		_io_mutex.unlock()
+		return true
+
+	# Queue the disk read plus read-ahead of unloaded horizontal neighbors
+	_io_mutex.lock()
+	_prefetch_requests.erase(chunk_pos)
+	_load_requests.append(chunk_pos)
+	for offset in READ_AHEAD_OFFSETS:
+		var neighbor_pos: Vector3i = chunk_pos + offset
+		if not _memory_tier.has(neighbor_pos) and not _pending_loads.has(neighbor_pos):
+			_prefetch_requests[neighbor_pos] = true
+	_io_mutex.unlock()
+	_io_semaphore.post()
+	return true
+
+## Collect finished loads: [{chunk_pos, chunk}] where chunk is null on a cache miss
+func poll_loaded(max_results: int = 16) -> Array[Dictionary]:
+	var finished: Array[Dictionary] = []
+	if _pending_loads.is_empty():
+		return finished
+
+	_drain_saved_payloads()
+
+	_io_mutex.lock()
+	var count := mini(max_results, _load_results.size())
+	var results := _load_results.slice(0, count)
+	_load_results = _load_results.slice(count)
+	_io_mutex.unlock()
+
+	for result in results:
+		var chunk_pos: Vector3i = result.chunk_pos
+		if not _pending_loads.has(chunk_pos):
+			continue  # Cancelled
+		_pending_loads.erase(chunk_pos)
+
+		var payload: PackedByteArray = result.payload
+		if not payload.is_empty():
+			_memory_tier_store(chunk_pos, payload)
+
+		# (blocking mode already counted these in load_chunk)
+		if async_io:
+			if result.chunk:
+				cache_hits += 1
+				chunks_loaded += 1
+			else:
+				cache_misses += 1
+		finished.append({"chunk_pos": chunk_pos, "chunk": result.chunk})
 
-	# Convert PackedByteArray to Array for JSON compatibility
-	if data.has("voxel_data") and data.voxel_data is PackedByteArray:
-		var byte_array: PackedByteArray = data.voxel_data
-		var int_array: Array = []
-		int_array.resize(byte_array.size())
-		for i in range(byte_array.size()):
-			int_array[i] = byte_array[i]
-		data.voxel_data = int_array
+	return finished
 
-	# Convert to JSON
-	var json_string := JSON.stringify(data)
+## Forget a requested load (its result is dropped when it arrives)
+func cancel_load(chunk_pos: Vector3i) -> void:
+	_pending_loads.erase(chunk_pos)
 
-	# Write to file
-	var file := FileAccess.open(cache_path, FileAccess.WRITE)
-	if not file:
-		print("[ChunkCache] ERROR: Failed to create cache file: %s" % cache_path)
+## Check if a load is waiting to be polled
+func is_load_pending(chunk_pos: Vector3i) -> bool:
+	return _pending_loads.has(chunk_pos)
+
+## Save a chunk to cache
+## In async mode the voxel data is snapshotted (copy-on-write) and written by the I/O thread
+func save_chunk(chunk: Chunk) -> bool:
+	if not cache_enabled or not chunk or not chunk.voxel_data:
 		return false
 
-	file.store_string(json_string)
-	file.close()
+	if async_io:
+		_ensure_io_thread()
+		# Drop the older payload so no reader sees it while the save is in flight
+		if _memory_tier.has(chunk.position):
+			_memory_tier_bytes -= _memory_tier[chunk.position].size()
+			_memory_tier.erase(chunk.position)
+		_io_mutex.lock()
+		_save_requests[chunk.position] = chunk.voxel_data.snapshot()
+		_prefetch_results.erase(chunk.position)
+		_io_mutex.unlock()
+		_io_semaphore.post()
+		return true
+
+	var raw := chunk.voxel_data.serialize()
+	var payload := encode_payload(raw, compression_codec)
+	if not _write_payload(chunk.position, payload):
+		return false
 
+	_memory_tier_store(chunk.position, payload)
 	chunks_saved += 1
+	bytes_raw += raw.size()
+	bytes_compressed += payload.size() - 1
 	return true
 
+## Read a stored payload from its region file (empty if absent or corrupt)
+func _read_payload(chunk_pos: Vector3i) -> PackedByteArray:
+	_region_mutex.lock()
+	var payload := PackedByteArray()
+	var region := _get_region(chunk_pos, false)
+	if region and region.has_chunk(chunk_pos):
+		# One seek + one read
+		payload = region.read_payload(chunk_pos)
+		if payload.is_empty():
+			print("[ChunkCache] ERROR: Corrupt payload for chunk %s in %s" % [chunk_pos, region.path])
+	_region_mutex.unlock()
+	return payload
+
+## Write a payload to its region file and update the size index
+func _write_payload(chunk_pos: Vector3i, payload: PackedByteArray) -> bool:
+	_region_mutex.lock()
+	var region := _get_region(chunk_pos, true)
+	var written := false
+	if region:
+		written = region.write_payload(chunk_pos, payload[0], payload.slice(1))
+		if written:
+			_update_size_index(RegionFile.region_position(chunk_pos), region.get_file_size())
+		else:
+			print("[ChunkCache] ERROR: Failed to write chunk %s to %s" % [chunk_pos, region.path])
+	_region_mutex.unlock()
+	return written
+
+## Decode a payload into a new Chunk (thread-safe, touches no shared state)
+static func _decode_chunk(chunk_pos: Vector3i, payload: PackedByteArray) -> Chunk:
+	var voxel_bytes := decode_payload(payload)
+	if voxel_bytes.is_empty():
+		return null
+
+	return Chunk.deserialize({
+		"position": {"x": chunk_pos.x, "y": chunk_pos.y, "z": chunk_pos.z},
+		"voxel_data": voxel_bytes
+	})
+
+## Check if a save for this chunk is queued but not yet written
+func _has_pending_save(chunk_pos: Vector3i) -> bool:
+	_io_mutex.lock()
+	var pending := _save_requests.has(chunk_pos)
+	_io_mutex.unlock()
+	return pending
+
+## Build a chunk from a queued (not yet written) save
+func _chunk_from_pending_save(chunk_pos: Vector3i) -> Chunk:
+	_io_mutex.lock()
+	var voxel_data: VoxelData = _save_requests.get(chunk_pos)
+	_io_mutex.unlock()
+	if not voxel_data:
+		return null
+
+	var chunk := Chunk.new()
+	chunk.position = chunk_pos
+	chunk.voxel_data = voxel_data.snapshot()
+	return chunk
+
+## Move payloads written by the I/O thread into the memory tier and statistics
+func _drain_saved_payloads() -> void:
+	_io_mutex.lock()
+	var saved := _saved_payloads
+	_saved_payloads = []
+	var prefetched := _prefetch_results
+	_prefetch_results = {}
+	_io_mutex.unlock()
+
+	for entry in saved:
+		_memory_tier_store(entry.chunk_pos, entry.payload)
+		chunks_saved += 1
+		bytes_raw += entry.raw_size
+		bytes_compressed += entry.payload.size() - 1
+
+	for chunk_pos in prefetched:
+		if not _memory_tier.has(chunk_pos):
+			_memory_tier_store(chunk_pos, prefetched[chunk_pos])
+
+## Start the I/O thread (no-op if running)
+func _start_io_thread() -> void:
+	if _io_thread:
+		return
+	_io_exit = false
+	_io_thread = Thread.new()
+	var error := _io_thread.start(_io_thread_function)
+	if error != OK:
+		print("[ChunkCache] ERROR: Failed to start I/O thread: %d - falling back to blocking I/O" % error)
+		_io_thread = null
+		async_io = false
+
+## Restart the I/O thread after close() if the cache is used again
+func _ensure_io_thread() -> void:
+	if async_io and not _io_thread:
+		_start_io_thread()
+
+## Stop the I/O thread after it flushes queued saves
+## Unanswered loads are reported as misses on the next poll (callers fall back to generation)
+func _stop_io_thread() -> void:
+	if not _io_thread:
+		return
+	_io_mutex.lock()
+	_io_exit = true
+	_io_mutex.unlock()
+	_io_semaphore.post()
+	_io_thread.wait_to_finish()
+	_io_thread = null
+
+	_io_mutex.lock()
+	for chunk_pos in _load_requests:
+		_load_results.append({"chunk_pos": chunk_pos, "chunk": null, "payload": PackedByteArray()})
+	_load_requests.clear()
+	_prefetch_requests.clear()
+	_prefetch_results.clear()
+	_io_mutex.unlock()
+
+## I/O thread main loop: writes queued saves as one batch, then serves loads and read-ahead
+func _io_thread_function() -> void:
+	if not _size_index_ready:
+		_scan_cache_size()
+
+	while true:
+		_io_semaphore.wait()
+
+		_io_mutex.lock()
+		var exiting := _io_exit
+		var saves := _save_requests
+		_save_requests = {}
+		var loads := _load_requests
+		_load_requests = []
+		var prefetches := _prefetch_requests.keys()
+		_prefetch_requests = {}
+		_io_mutex.unlock()
+
+		# Saves first, so a load queued after a save always reads the new data
+		if not saves.is_empty():
+			_write_save_batch(saves)
+
+		if exiting:
+			break
+
+		# Payloads are only handed to the memory tier if no newer save was queued meanwhile
+		for chunk_pos in loads:
+			var payload := _read_payload(chunk_pos)
+			var chunk: Chunk = _decode_chunk(chunk_pos, payload) if not payload.is_empty() else null
+			_io_mutex.lock()
+			if not chunk or _save_requests.has(chunk_pos):
+				payload = PackedByteArray()
+			_load_results.append({"chunk_pos": chunk_pos, "chunk": chunk, "payload": payload})
+			_io_mutex.unlock()
+
+		for chunk_pos in prefetches:
+			var payload := _read_payload(chunk_pos)
+			if not payload.is_empty():
+				_io_mutex.lock()
+				if not _save_requests.has(chunk_pos):
+					_prefetch_results[chunk_pos] = payload
+				_io_mutex.unlock()
+
+## Serialize, compress and write a batch of saves, grouped by region file
+## (sorting keeps each region open for its whole run and writes close together on disk)
+func _write_save_batch(saves: Dictionary) -> void:
+	var positions: Array = saves.keys()
+	positions.sort_custom(func(a: Vector3i, b: Vector3i) -> bool:
+		var ra := RegionFile.region_position(a)
+		var rb := RegionFile.region_position(b)
+		if ra != rb:
+			return ra < rb
+		return RegionFile.entry_index(a) < RegionFile.entry_index(b))
+
+	var written: Array[Dictionary] = []
+	for chunk_pos in positions:
+		var voxel_data: VoxelData = saves[chunk_pos]
+		var raw := voxel_data.serialize()
+		var payload := encode_payload(raw, compression_codec)
+		if _write_payload(chunk_pos, payload):
+			written.append({"chunk_pos": chunk_pos, "payload": payload, "raw_size": raw.size()})
+
+	_io_mutex.lock()
+	for entry in written:
+		# A newer save of the same chunk supersedes this payload
+		if not _save_requests.has(entry.chunk_pos):
+			_saved_payloads.append(entry)
+	_io_mutex.unlock()
+
+## Encode VoxelData.serialize() bytes into a payload ([codec][data])
+## Falls back to raw when the data is tiny or doesn't compress
+static func encode_payload(raw: PackedByteArray, codec: int) -> PackedByteArray:
+	var payload := PackedByteArray()
+	payload.resize(1)
+
+	if codec != CODEC_RAW and raw.size() >= MIN_COMPRESS_SIZE:
+		var compressed := raw.compress(_compression_mode(codec))
+		if compressed.size() + 4 < raw.size():
+			payload[0] = codec
+			payload.resize(5)
+			payload.encode_u32(1, raw.size())
+			payload.append_array(compressed)
+			return payload
+
+	payload[0] = CODEC_RAW
+	payload.append_array(raw)
+	return payload
+
+## Decode a stored payload ([codec][data]) back into VoxelData.serialize() bytes
+static func decode_payload(payload: PackedByteArray) -> PackedByteArray:
+	var codec := payload[0]
+	match codec:
+		CODEC_RAW:
+			return payload.slice(1)
+		CODEC_FASTLZ, CODEC_ZSTD:
+			if payload.size() < 5:
+				return PackedByteArray()
+			var raw_size := payload.decode_u32(1)
+			var raw := payload.slice(5).decompress(raw_size, _compression_mode(codec))
+			if raw.size() != raw_size:
+				print("[ChunkCache] ERROR: Decompressed size mismatch (%d != %d)" % [raw.size(), raw_size])
+				return PackedByteArray()
+			return raw
+		_:
+			print("[ChunkCache] ERROR: Unknown payload codec %d" % codec)
+			return PackedByteArray()
+
+## Map a payload codec to Godot's compression mode
+static func _compression_mode(codec: int) -> int:
+	return FileAccess.COMPRESSION_ZSTD if codec == CODEC_ZSTD else FileAccess.COMPRESSION_FASTLZ
+
+## Insert or refresh a payload in the memory tier, evicting least recently used entries
+func _memory_tier_store(chunk_pos: Vector3i, payload: PackedByteArray) -> void:
+	if _memory_tier.has(chunk_pos):
+		_memory_tier_bytes -= _memory_tier[chunk_pos].size()
+		_memory_tier.erase(chunk_pos)
+
+	_memory_tier[chunk_pos] = payload
+	_memory_tier_bytes += payload.size()
+
+	var limit_bytes := int(memory_tier_limit_mb * 1024.0 * 1024.0)
+	while _memory_tier_bytes > limit_bytes and not _memory_tier.is_empty():
+		var oldest_pos = _memory_tier.keys()[0]
+		_memory_tier_bytes -= _memory_tier[oldest_pos].size()
+		_memory_tier.erase(oldest_pos)
+
+## Mark a memory tier entry as most recently used
+func _memory_tier_touch(chunk_pos: Vector3i, payload: PackedByteArray) -> void:
+	_memory_tier.erase(chunk_pos)
+	_memory_tier[chunk_pos] = payload
+
+## Drop all memory tier entries
+func _memory_tier_clear() -> void:
+	_memory_tier.clear()
+	_memory_tier_bytes = 0
+
 ## Clear all cached chunks for current seed
 func clear_cache() -> void:
-	var seed_dir := "%s%d/" % [cache_directory, world_seed]
+	close()
+	_memory_tier_clear()
+
+	var seed_dir := _get_seed_directory()
 	var dir := DirAccess.open(seed_dir)
 	if not dir:
 		return
@@ -156,7 +613,8 @@ func clear_cache() -> void:
 	var deleted_count := 0
 
 	while file_name != "":
-		if not dir.current_is_dir() and file_name.ends_with(".chunk"):
+		# Region files (plus legacy one-file-per-chunk JSON files)
+		if not dir.current_is_dir() and (file_name.ends_with("." + RegionFile.FILE_EXTENSION) or file_name.ends_with(".chunk")):
 			var error := dir.remove(file_name)
 			if error == OK:
 				deleted_count += 1
@@ -164,7 +622,8 @@ func clear_cache() -> void:
 
 	dir.list_dir_end()
 
-	print("[ChunkCache] Cleared %d cached chunks" % deleted_count)
+	print("[ChunkCache] Cleared %d cache files" % deleted_count)
+	_reset_size_index()
 
 	# Reset statistics
 	chunks_saved = 0
@@ -174,6 +633,9 @@ func clear_cache() -> void:
 
 ## Clear entire cache directory (all seeds)
 func clear_all_caches() -> void:
+	close()
+	_memory_tier_clear()
+
 	var dir := DirAccess.open(cache_directory)
 	if not dir:
 		return
@@ -194,6 +656,7 @@ func clear_all_caches() -> void:
 	dir.list_dir_end()
 
 	print("[ChunkCache] Cleared %d seed caches" % deleted_seeds)
+	_reset_size_index()
 
 ## Recursively remove a directory and its contents
 func _remove_directory_recursive(path: String) -> void:
@@ -219,6 +682,11 @@ func _remove_directory_recursive(path: String) -> void:
 
 ## Get cache statistics
 func get_stats() -> Dictionary:
+	_drain_saved_payloads()
+	_io_mutex.lock()
+	var queued_saves := _save_requests.size()
+	_io_mutex.unlock()
+
 	return {
 		"enabled": cache_enabled,
 		"seed": world_seed,
@@ -227,32 +695,68 @@ func get_stats() -> Dictionary:
 		"hit_rate": (float(cache_hits) / max(cache_hits + cache_misses, 1)) * 100.0,
 		"chunks_saved": chunks_saved,
 		"chunks_loaded": chunks_loaded,
+		"memory_tier_hits": memory_tier_hits,
+		"memory_tier_chunks": _memory_tier.size(),
+		"memory_tier_mb": _memory_tier_bytes / (1024.0 * 1024.0),
+		"compression_ratio": float(bytes_raw) / max(bytes_compressed, 1),
+		"async_io": async_io,
+		"pending_loads": _pending_loads.size(),
+		"queued_saves": queued_saves,
 		"cache_size_mb": _get_cache_size_mb()
 	}
 
-## Get current cache size in megabytes
+## Get current cache size in megabytes (from the size index - no disk access)
 func _get_cache_size_mb() -> float:
-	var seed_dir := "%s%d/" % [cache_directory, world_seed]
-	var dir := DirAccess.open(seed_dir)
-	if not dir:
-		return 0.0
+	if not _size_index_ready and not _io_thread:
+		_scan_cache_size()
 
-	var total_bytes := 0
-	dir.list_dir_begin()
-	var file_name := dir.get_next()
-
-	while file_name != "":
-		if not dir.current_is_dir() and file_name.ends_with(".chunk"):
-			var file_path := seed_dir + file_name
-			var file := FileAccess.open(file_path, FileAccess.READ)
-			if file:
-				total_bytes += file.get_length()
-				file.close()
-		file_name = dir.get_next()
+	_io_mutex.lock()
+	var total_bytes := _size_bytes
+	_io_mutex.unlock()
+	return total_bytes / (1024.0 * 1024.0)
 
-	dir.list_dir_end()
+## Build the size index with one scan of the seed directory (file sizes only, no opens)
+func _scan_cache_size() -> void:
+	var seed_dir := _get_seed_directory()
+	var sizes: Dictionary = {}
+	var total_bytes := 0
 
-	return total_bytes / (1024.0 * 1024.0)
+	var dir := DirAccess.open(seed_dir)
+	if dir:
+		dir.list_dir_begin()
+		var file_name := dir.get_next()
+
+		while file_name != "":
+			if not dir.current_is_dir() and file_name.ends_with("." + RegionFile.FILE_EXTENSION):
+				var parts := file_name.split(".")
+				if parts.size() == 5:
+					var size := FileAccess.get_size(seed_dir + file_name)
+					sizes[Vector3i(parts[1].to_int(), parts[2].to_int(), parts[3].to_int())] = size
+					total_bytes += size
+			file_name = dir.get_next()
+
+		dir.list_dir_end()
+
+	_io_mutex.lock()
+	_region_sizes = sizes
+	_size_bytes = total_bytes
+	_size_index_ready = true
+	_io_mutex.unlock()
+
+## Record a region's new file size in the size index
+func _update_size_index(region_pos: Vector3i, file_size: int) -> void:
+	_io_mutex.lock()
+	_size_bytes += file_size - _region_sizes.get(region_pos, 0)
+	_region_sizes[region_pos] = file_size
+	_io_mutex.unlock()
+
+## Reset the size index to empty (cache cleared)
+func _reset_size_index() -> void:
+	_io_mutex.lock()
+	_region_sizes.clear()
+	_size_bytes = 0
+	_size_index_ready = true
+	_io_mutex.unlock()
 
 ## Check if cache size exceeds maximum
 func is_cache_full() -> bool:
@@ -270,6 +774,9 @@ func print_stats() -> void:
 	print("  Hit Rate: %.1f%%" % stats.hit_rate)
 	print("  Chunks Saved: %d" % stats.chunks_saved)
 	print("  Chunks Loaded: %d" % stats.chunks_loaded)
+	print("  Memory Tier: %d chunks, %.2f MB, %d hits" % [stats.memory_tier_chunks, stats.memory_tier_mb, stats.memory_tier_hits])
+	print("  Compression Ratio: %.2fx" % stats.compression_ratio)
+	print("  Async I/O: %s (%d loads pending, %d saves queued)" % [stats.async_io, stats.pending_loads, stats.queued_saves])
 	print("  Cache Size: %.2f MB / %d MB" % [stats.cache_size_mb, max_cache_size_mb])
 	print("========================================")
 
@@ -277,6 +784,8 @@ func print_stats() -> void:
 func set_world_seed(new_seed: int) -> void:
 	if new_seed != world_seed:
 		print("[ChunkCache] World seed changed from %d to %d" % [world_seed, new_seed])
+		close()
+		_memory_tier_clear()
 		world_seed = new_seed
 
 		# Reset statistics for new seed
@@ -285,4 +794,5 @@ func set_world_seed(new_seed: int) -> void:
 		chunks_saved = 0
 		chunks_loaded = 0
 
+		_size_index_ready = false
 		_ensure_cache_directory()
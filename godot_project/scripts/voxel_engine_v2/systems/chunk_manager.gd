@@ -6,9 +6,9 @@
 ## - Terrain generation: Always threaded (worker threads via ChunkThreadPool)
 ## - Mesh building:
 ##   - Region batching ENABLED (default): Fully threaded
-##     Individual chunks build mesh arrays on worker threads
-##     Region mesh combining also happens on worker threads
-##     Only final mesh instance creation happens on main thread
+##     Individual chunks build region-local mesh arrays on worker threads
+##     The main thread uploads each chunk into its slot of the region buffer
+##     (partial buffer updates - a chunk change never rebuilds the whole region)
 ##   - Region batching DISABLED: Threaded via ChunkThreadPool
 ##     Each chunk gets its own mesh built on worker thread
 class_name ChunkManager
@@ -28,6 +28,13 @@ signal initial_chunks_ready()  # Emitted once when first batch of chunks is visi
 @export var worker_thread_count: int = 4
 @export var max_jobs_per_frame: int = 4  # Process fewer jobs per frame to reduce main thread blocking
 @export var enable_region_batching: bool = true  # Enable region-based mesh batching
+@export var enable_occlusion_culling: bool = false  # Hide chunks unreachable through cave connectivity
+@export var enable_lod: bool = true  # Downsampled terrain tiles beyond render_distance
+@export var lod_distance: int = 48  # LOD terrain radius in chunks (16-block columns)
+@export var enable_far_terrain: bool = true  # Heightfield clipmap horizon beyond the LOD terrain
+@export var far_terrain_rings: int = 3  # Clipmap rings (each doubles the reach)
+@export var enable_lighting: bool = true  # Baked block light and sunlight (LightEngine)
+@export var wait_for_neighbors: bool = true  # Hold a new chunk's first mesh until its neighbors land
 
 ## Minimum chunks to consider "initial load" complete
 const INITIAL_CHUNKS_THRESHOLD: int = 10
@@ -35,8 +42,8 @@ const INITIAL_CHUNKS_THRESHOLD: int = 10
 ## Tracking for initial load
 var _initial_chunks_ready: bool = false
 
-## Active chunks in the world (Vector3i chunk_pos -> Chunk)
-var active_chunks: Dictionary = {}
+## Active chunks in the world (chunk position -> Chunk)
+var active_chunks: ChunkMap = ChunkMap.new()
 
 ## Chunk object pool for reuse
 var chunk_pool: Array[Chunk] = []
@@ -47,9 +54,16 @@ var load_queue: Array[Vector3i] = []
 ## Chunks currently being generated (Vector3i -> true)
 var generating_chunks: Dictionary = {}
 
+## Chunks waiting on an asynchronous cache read (Vector3i -> true)
+var loading_chunks: Dictionary = {}
+
 ## Chunks currently being meshed (Vector3i -> Chunk)
 var meshing_chunks: Dictionary = {}
 
+## Thread pool handles for queued generation/meshing jobs (Vector3i -> ChunkJob)
+## Used to cancel work for chunks that go out of range before their job runs
+var chunk_jobs: Dictionary = {}
+
 ## Region-based rendering (Vector3i region_pos -> ChunkRegion)
 var active_regions: Dictionary = {}
 
@@ -57,31 +71,32 @@ var active_regions: Dictionary = {}
 ## Dictionary iteration order is non-deterministic, causing frame-spreading to fail
 var regions_array: Array[ChunkRegion] = []
 
-## Regions that need mesh rebuilding
-var dirty_regions: Dictionary = {}  # Vector3i -> true
+## Chunks whose meshed arrays (chunk.cached_mesh_arrays / cached_translucent_arrays) wait for
+## upload to their region slots
+var pending_chunk_uploads: Dictionary = {}  # Vector3i -> true
 
-## Regions currently being rebuilt (to avoid duplicate jobs)
-var rebuilding_regions: Dictionary = {}  # Vector3i -> true
+## Per-frame budget for region slot uploads (prevent main thread stalls)
+## Uploads are partial buffer writes, so the budget is vertices rather than meshes
+const MAX_VERTICES_PER_FRAME: int = 32768  # Maximum vertices to upload in one frame
+const MAX_UPLOAD_TIME_MS: float = 4.0  # Maximum time to spend uploading per frame
+
+## Chunks pending neighbor mesh rebuild (Vector3i -> true) - batched to avoid duplicates
+var pending_neighbor_rebuilds: Dictionary = {}
 
-## Queue for pending mesh creations (to avoid main thread stalls)
-## Each entry is a Dictionary with: region_pos, region, combined_arrays, vertex_count, chunk_count, cache_hits, cache_misses
-var pending_mesh_creations: Array[Dictionary] = []
+## New chunks holding their first mesh until every face neighbor is linked or known not to
+## be coming, so they aren't meshed against stone padding and then again when a neighbor
+## lands (Vector3i -> wait start msec)
+var neighbor_wait_chunks: Dictionary = {}
 
-## Maximum regions to rebuild per frame (adaptive based on performance)
-var max_region_rebuilds_per_frame: int = 4  # Start conservative, will adapt
-const MIN_REGION_REBUILDS_PER_FRAME: int = 1  # Never go below this
-const MAX_REGION_REBUILDS_PER_FRAME: int = 8  # Never go above this
-const TARGET_FRAME_TIME_MS: float = 16.0  # Target 60 FPS
+## Longest a new chunk waits for its neighbors before it is meshed anyway
+const MAX_NEIGHBOR_WAIT_MS: int = 500
 
-## Maximum mesh creations per frame (prevent main thread stalls)
-const MAX_MESH_CREATIONS_PER_FRAME: int = 1  # Create only 1 mesh per frame
-# PERFORMANCE FIX: Reduced from 10000 to 3000 to prevent 2-3 second stalls on large meshes
-# ArrayMesh.add_surface_from_arrays() blocks for GPU upload - must keep meshes small
-const MAX_VERTICES_PER_FRAME: int = 3000  # Maximum vertices to process in one frame
-const MAX_MESH_CREATION_TIME_MS: float = 5.0  # Maximum time to spend creating meshes per frame (target 200 FPS during loading)
+## Open edit transactions (begin_edit/commit nesting depth)
+var _edit_depth: int = 0
 
-## Chunks pending neighbor mesh rebuild (Vector3i -> true) - batched to avoid duplicates
-var pending_neighbor_rebuilds: Dictionary = {}
+## Voxel writes buffered by the open transaction: chunk position -> {voxel index: type}
+## (later writes to the same voxel replace earlier ones)
+var _pending_edits: Dictionary = {}
 
 ## Last player position used for chunk updates
 var last_update_position: Vector3 = Vector3.ZERO
@@ -89,6 +104,9 @@ var last_update_position: Vector3 = Vector3.ZERO
 ## Distance threshold before triggering chunk update
 const UPDATE_THRESHOLD: float = 8.0
 
+## Re-score queued jobs when the camera turns by more than this (dot product of old/new forward)
+const REPRIORITIZE_TURN_DOT: float = 0.9
+
 ## Maximum chunks to load per frame (prevents stuttering)
 const MAX_CHUNKS_PER_FRAME: int = 4  # Match region rebuild rate to avoid bottleneck
 
@@ -105,18 +123,36 @@ var mesh_builder = null
 var chunk_cache: ChunkCache = null
 var thread_pool: ChunkThreadPool = null
 var occlusion_culler: OcclusionCuller = null
+var lod_manager: LodManager = null
+var far_terrain: FarTerrain = null
+var light_engine: LightEngine = null
 
-## Frustum culling optimization - spread work over multiple frames
-# PERFORMANCE FIX: Increased from 4 to 8 to further reduce per-frame cost
-# This means each region gets checked every 8 frames instead of every 4 frames
-const FRUSTUM_CULL_FRAMES: int = 8  # Check 1/8 of regions per frame
-var frustum_cull_frame_counter: int = 0
+## Frustum culling: every region (or chunk, without batching) is tested each frame
+## against a structure-of-arrays bounds table; nodes are only touched when visibility changes
+var frustum_culler: FrustumCuller = FrustumCuller.new()
+
+## Culling slot owners (slot -> ChunkRegion or Chunk, null for free slots)
+var _cull_slot_owners: Array = []
+
+## Region the camera was in when translucent slots were last sorted back-to-front
+## (every region is re-sorted when the camera crosses into another region)
+var _translucent_sort_region: Vector3i = Vector3i(0x7FFFFFFF, 0, 0)
+
+## Regions with a translucent slot uploaded out of back-to-front order since the last sort
+## (region_pos -> true); new and regrown slots land wherever the buffer has room
+var _translucent_unsorted_regions: Dictionary = {}
 
 ## Statistics
 var stats_active_chunks: int = 0
 var stats_pooled_chunks: int = 0
 var stats_chunks_generated: int = 0
 var stats_chunks_meshed: int = 0
+var stats_chunks_enclosed: int = 0  # Generated without faces, never meshed
+var stats_edit_commits: int = 0
+var stats_voxels_edited: int = 0
+var stats_partial_remeshes: int = 0  # Meshes that re-meshed only an edit's dirty slices
+var stats_neighbor_waits: int = 0  # First meshes held back for neighbors
+var stats_bytes_uploaded: int = 0  # Bytes written into region slots
 
 func _ready() -> void:
 	print("[ChunkManager] _ready() called")
@@ -129,6 +165,10 @@ func _ready() -> void:
 	print("  - cache_size_limit_mb: %d MB" % cache_size_limit_mb)
 	print("  - enable_threading: %s" % enable_threading)
 	print("  - worker_thread_count: %d" % worker_thread_count)
+	print("  - enable_occlusion_culling: %s" % enable_occlusion_culling)
+	print("  - enable_lod: %s (lod_distance: %d)" % [enable_lod, lod_distance])
+	print("  - enable_far_terrain: %s (far_terrain_rings: %d)" % [enable_far_terrain, far_terrain_rings])
+	print("  - enable_lighting: %s" % enable_lighting)
 
 	# Initialize VoxelTypes registry
 	print("[ChunkManager] Initializing VoxelTypes registry...")
@@ -145,7 +185,7 @@ func _ready() -> void:
 	# Initialize chunk cache (seed will be set by VoxelWorld)
 	if enable_chunk_cache:
 		print("[ChunkManager] Initializing chunk cache...")
-		chunk_cache = ChunkCache.new(0, true)
+		chunk_cache = ChunkCache.new(0, true, enable_threading)
 		chunk_cache.max_cache_size_mb = cache_size_limit_mb
 		print("[ChunkManager] Chunk cache initialized")
 
@@ -160,12 +200,29 @@ func _ready() -> void:
 		print("[ChunkManager] Chunk pooling disabled")
 
 	# Initialize occlusion culler
+	# Flood fill walks per-chunk face connectivity computed by the mesher (cave culling)
 	print("[ChunkManager] Initializing occlusion culler...")
 	occlusion_culler = OcclusionCuller.new(self)
-	# PERFORMANCE FIX: Disable occlusion culling - it causes 200ms+ stalls with flood-fill
-	# Region batching already provides good culling granularity
-	occlusion_culler.mode = OcclusionCuller.Mode.DISABLED
-	print("[ChunkManager] Occlusion culler initialized (DISABLED for performance)")
+	occlusion_culler.mode = OcclusionCuller.Mode.FLOOD_FILL if enable_occlusion_culling else OcclusionCuller.Mode.DISABLED
+	print("[ChunkManager] Occlusion culler initialized (%s)" % OcclusionCuller.Mode.keys()[occlusion_culler.mode])
+
+	# Initialize light propagation (chunks are lit when they activate, meshes bake the levels)
+	if enable_lighting:
+		light_engine = LightEngine.new(self)
+		print("[ChunkManager] Light engine initialized")
+
+	# Initialize distant terrain LOD (tiles are built on the thread pool)
+	if enable_lod and thread_pool:
+		print("[ChunkManager] Initializing LOD manager...")
+		lod_manager = LodManager.new(self)
+		print("[ChunkManager] LOD manager initialized (%d chunk radius)" % lod_distance)
+	elif enable_lod:
+		print("[ChunkManager] LOD disabled (requires threading)")
+
+	# Initialize far terrain (heightfield rings outside everything above)
+	if enable_far_terrain and far_terrain_rings > 0:
+		print("[ChunkManager] Initializing far terrain...")
+		far_terrain = FarTerrain.new(self, far_terrain_rings, _get_far_terrain_inner_radius())
 
 	# Print adaptive chunk sizing configuration
 	print("[ChunkManager] Adaptive chunk sizing enabled:")
@@ -185,6 +242,17 @@ func update_chunks(player_position: Vector3, camera_forward: Vector3 = Vector3.F
 		_initial_load_chunks(player_position, camera_forward)
 		return
 
+	# Re-score queued jobs when the camera turns without moving far
+	if thread_pool and camera_forward.dot(tracked_camera_forward) < REPRIORITIZE_TURN_DOT:
+		tracked_camera_forward = camera_forward
+		thread_pool.reprioritize(_score_job)
+
+	# Distant terrain tiles (re-selected on their own movement threshold)
+	if lod_manager and _initial_chunks_ready:
+		lod_manager.update(player_position)
+	if far_terrain and _initial_chunks_ready:
+		far_terrain.update(player_position, _get_far_terrain_inner_radius())
+
 	# Check if we need to update chunk loading
 	var distance := last_update_position.distance_to(player_position)
 	if distance < UPDATE_THRESHOLD:
@@ -194,6 +262,11 @@ func update_chunks(player_position: Vector3, camera_forward: Vector3 = Vector3.F
 
 	last_update_position = player_position
 	tracked_position = player_position
+	tracked_camera_forward = camera_forward
+
+	# Height tiles near the player survive cache eviction
+	if terrain_generator:
+		terrain_generator.set_cache_focus(player_position)
 
 	# Get player's chunk position
 	var player_chunk_pos := world_to_chunk_position(player_position)
@@ -202,9 +275,13 @@ func update_chunks(player_position: Vector3, camera_forward: Vector3 = Vector3.F
 	var needed_chunks: Dictionary = {}
 	_calculate_needed_chunks(player_chunk_pos, needed_chunks)
 
-	# Remove chunks that are too far
+	# Remove chunks that are too far (also cancels their queued jobs)
 	_unload_distant_chunks(needed_chunks)
 
+	# Re-score what's still queued against the new position before adding more work
+	if thread_pool:
+		thread_pool.reprioritize(_score_job)
+
 	# Load new chunks with prioritization
 	_load_new_chunks_prioritized(needed_chunks, player_position, camera_forward)
 
@@ -223,22 +300,24 @@ func _process(delta: float) -> void:
 		jobs_processed = thread_pool.process_completed_jobs(_on_job_completed, max_jobs_per_frame)
 	var jobs_time := (Time.get_ticks_usec() - jobs_start) / 1000.0
 
+	# Hand finished cache reads to meshing (hits) or generation (misses)
+	if thread_pool and not loading_chunks.is_empty():
+		_process_cache_loads()
+
+	# Start first meshes whose neighbors have arrived
+	if not neighbor_wait_chunks.is_empty():
+		_process_neighbor_waits()
+
 	# Process batched neighbor rebuilds (prevents duplicate rebuilds in same frame)
 	var neighbor_start := Time.get_ticks_usec()
 	_process_pending_neighbor_rebuilds()
 	var neighbor_time := (Time.get_ticks_usec() - neighbor_start) / 1000.0
 
-	# Process pending mesh creations (spread over multiple frames to prevent stalls)
-	var mesh_start := Time.get_ticks_usec()
+	# Upload meshed chunks into their region slots (budgeted per frame)
+	var upload_start := Time.get_ticks_usec()
 	if enable_region_batching:
-		_process_pending_mesh_creations()
-	var mesh_time := (Time.get_ticks_usec() - mesh_start) / 1000.0
-
-	# Rebuild dirty regions if region batching is enabled
-	var dirty_start := Time.get_ticks_usec()
-	if enable_region_batching:
-		_process_dirty_regions()
-	var dirty_time := (Time.get_ticks_usec() - dirty_start) / 1000.0
+		_process_pending_chunk_uploads()
+	var upload_time := (Time.get_ticks_usec() - upload_start) / 1000.0
 
 	var process_total := (Time.get_ticks_usec() - process_start) / 1000.0
 
@@ -247,8 +326,7 @@ func _process(delta: float) -> void:
 		print("[ChunkManager] SLOW FRAME (%.2fms total):" % process_total)
 		print("  - Job processing: %.2fms (%d jobs)" % [jobs_time, jobs_processed])
 		print("  - Neighbor rebuilds: %.2fms" % neighbor_time)
-		print("  - Mesh creations: %.2fms (%d pending)" % [mesh_time, pending_mesh_creations.size()])
-		print("  - Dirty regions: %.2fms (%d dirty)" % [dirty_time, dirty_regions.size()])
+		print("  - Chunk uploads: %.2fms (%d pending)" % [upload_time, pending_chunk_uploads.size()])
 
 ## Handle completed job from thread pool
 func _on_job_completed(job) -> void:
@@ -256,8 +334,11 @@ func _on_job_completed(job) -> void:
 		_on_generation_completed(job)
 	elif job.job_type == ChunkThreadPool.JobType.BUILD_MESH:
 		_on_meshing_completed(job)
-	elif job.job_type == ChunkThreadPool.JobType.BUILD_REGION_MESH:
-		_on_region_rebuild_completed(job)
+	elif job.job_type == ChunkThreadPool.JobType.BUILD_LOD:
+		if lod_manager:
+			lod_manager.on_tile_built(job)
+	elif job.job_type == ChunkThreadPool.JobType.COMPUTE_LIGHT:
+		_on_light_completed(job)
 
 ## Handle completed terrain generation job
 func _on_generation_completed(job) -> void:
@@ -265,6 +346,8 @@ func _on_generation_completed(job) -> void:
 
 	# Remove from generating set
 	generating_chunks.erase(chunk_pos)
+	if chunk_jobs.get(chunk_pos) == job:
+		chunk_jobs.erase(chunk_pos)
 
 	# Check for errors
 	if job.error:
@@ -288,11 +371,30 @@ func _on_generation_completed(job) -> void:
 	stats_chunks_generated += 1
 
 	# Add to active chunks
-	active_chunks[chunk_pos] = chunk
+	active_chunks.insert(chunk_pos, chunk)
 
 	# Update neighbor references
 	_update_chunk_neighbors(chunk_pos, chunk)
 
+	# Light computed on the worker, stitched to the neighbors before meshing
+	if light_engine:
+		_light_activated_chunk(chunk, job.light)
+
+	# Buried stone and deep water have nothing to mesh
+	if voxel_data.is_enclosed:
+		_activate_enclosed_chunk(chunk)
+		return
+
+	if not _is_chunk_meshable(chunk):
+		_wait_for_neighbors(chunk)
+		return
+
+	_begin_first_mesh(chunk)
+
+## Start a generated chunk's first mesh
+func _begin_first_mesh(chunk: Chunk) -> void:
+	var chunk_pos := chunk.position
+
 	# Handle meshing based on batching mode
 	if enable_region_batching:
 		# Region batching mode: Queue mesh array building on worker thread
@@ -301,11 +403,10 @@ func _on_generation_completed(job) -> void:
 		meshing_chunks[chunk_pos] = chunk
 
 		if thread_pool and mesh_builder:
-			var priority: float = 1.0 / max(tracked_position.distance_to(chunk.get_world_position()), 1.0)
-			thread_pool.queue_meshing_job(chunk, mesh_builder, priority)
+			_queue_chunk_meshing(chunk)
 		else:
 			# Fallback to synchronous meshing (should not happen with threading enabled)
-			chunk.cached_mesh_arrays = mesh_builder.build_mesh_arrays(chunk)
+			_build_region_arrays_sync(chunk)
 			chunk.state = Chunk.State.ACTIVE
 			stats_chunks_meshed += 1
 			_add_chunk_to_region(chunk)
@@ -316,12 +417,40 @@ func _on_generation_completed(job) -> void:
 		meshing_chunks[chunk_pos] = chunk
 
 		if thread_pool:
-			var priority: float = 1.0 / max(tracked_position.distance_to(chunk.get_world_position()), 1.0)
-			thread_pool.queue_meshing_job(chunk, mesh_builder, priority)
+			_queue_chunk_meshing(chunk)
 		else:
 			# Fallback to synchronous meshing
 			_build_chunk_mesh_sync(chunk)
 
+## Check if a new chunk can be meshed: every face neighbor is linked (Chunk.neighbor_mask)
+## or not on its way - no generation job or cache read in flight for it
+func _is_chunk_meshable(chunk: Chunk) -> bool:
+	if not wait_for_neighbors or not thread_pool or chunk.has_all_neighbors():
+		return true
+	for face in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		if chunk.neighbor_mask & (1 << face):
+			continue
+		var neighbor_pos := chunk.position + Chunk.NEIGHBOR_OFFSETS[face]
+		if generating_chunks.has(neighbor_pos) or loading_chunks.has(neighbor_pos):
+			return false
+	return true
+
+## Hold a new chunk's first mesh until its neighbors arrive (_process_neighbor_waits)
+func _wait_for_neighbors(chunk: Chunk) -> void:
+	neighbor_wait_chunks[chunk.position] = Time.get_ticks_msec()
+	stats_neighbor_waits += 1
+
+## Mesh waiting chunks that became meshable or waited MAX_NEIGHBOR_WAIT_MS
+func _process_neighbor_waits() -> void:
+	var now := Time.get_ticks_msec()
+	for chunk_pos in neighbor_wait_chunks.keys():
+		var chunk := active_chunks.get_chunk(chunk_pos)
+		if chunk and not _is_chunk_meshable(chunk) and now - neighbor_wait_chunks[chunk_pos] < MAX_NEIGHBOR_WAIT_MS:
+			continue
+		neighbor_wait_chunks.erase(chunk_pos)
+		if chunk:
+			_begin_first_mesh(chunk)
+
 ## Handle completed mesh building job
 func _on_meshing_completed(job) -> void:
 	var chunk_pos: Vector3i = job.chunk_pos
@@ -329,6 +458,8 @@ func _on_meshing_completed(job) -> void:
 	# Remove from meshing set
 	var chunk: Chunk = meshing_chunks.get(chunk_pos)
 	meshing_chunks.erase(chunk_pos)
+	if chunk_jobs.get(chunk_pos) == job:
+		chunk_jobs.erase(chunk_pos)
 
 	if not chunk:
 		return
@@ -345,21 +476,33 @@ func _on_meshing_completed(job) -> void:
 
 	# Get mesh data
 	var mesh_data: Dictionary = job.result
-	if mesh_data.is_empty():
-		return
+	_store_quad_cache(chunk, mesh_data)
+
+	# Neighbors that were linked or unlinked after the snapshot need another pass
+	if chunk.meshed_neighbor_mask != chunk.neighbor_mask:
+		pending_neighbor_rebuilds[chunk_pos] = true
+
+	# Face connectivity is known even for chunks that produced no geometry
+	# (an empty result means the chunk was edited down to air: open on every side)
+	var connectivity: int = mesh_data.get("connectivity", BinaryGreedyMesher.CONNECTIVITY_ALL)
+	if chunk.face_connectivity != connectivity:
+		chunk.face_connectivity = connectivity
+		if occlusion_culler:
+			occlusion_culler.mark_graph_dirty()
 
 	# Handle mesh creation based on batching mode
-	if enable_region_batching:
-		# Region batching mode: Cache the mesh arrays for fast region rebuilding
-		# Extract arrays from mesh_data if available
-		if mesh_data.has("arrays") and mesh_data.arrays is Array:
-			chunk.cached_mesh_arrays = mesh_data.arrays
+	if not mesh_data.has("arrays"):
+		_finish_chunk_without_geometry(chunk)
+	elif enable_region_batching:
+		# Region batching mode: Keep the region-local arrays until they're uploaded to the slot
+		chunk.cached_mesh_arrays = mesh_data.arrays
+		chunk.cached_translucent_arrays = mesh_data.translucent_arrays
 
 		# Activate chunk
 		chunk.state = Chunk.State.ACTIVE
 		stats_chunks_meshed += 1
 
-		# Add chunk to region (will use cached arrays)
+		# Add chunk to region (queues the slot upload)
 		_add_chunk_to_region(chunk)
 
 		# Check if initial chunks are ready
@@ -382,6 +525,7 @@ func _on_meshing_completed(job) -> void:
 			chunk.mesh_instance = mesh_instance
 			mesh_instance.position = chunk.get_world_position()
 			add_child(mesh_instance)
+			_register_chunk_culling(chunk)
 			stats_chunks_meshed += 1
 
 		# Now remove old mesh after new one is visible (prevents flashing)
@@ -405,204 +549,129 @@ func _on_meshing_completed(job) -> void:
 	if not is_rebuild:
 		_rebuild_neighbor_meshes(chunk_pos)
 
-## Handle completed region mesh building job
-func _on_region_rebuild_completed(job) -> void:
-	var region_pos: Vector3i = job.region_pos
-
-	# Remove from rebuilding set
-	rebuilding_regions.erase(region_pos)
-
-	# Remove from dirty regions
-	dirty_regions.erase(region_pos)
-
-	# Check for errors
-	if job.error:
-		push_error("[ChunkManager] Region rebuild error for region %s: %s" % [region_pos, job.error])
-		return
-
-	# Get region
-	if not region_pos in active_regions:
-		# Region was unloaded while being rebuilt
-		return
-
-	var region: ChunkRegion = active_regions[region_pos]
-	if not region or not is_instance_valid(region):
-		# Region was freed
-		return
-
-	# Get result data
-	var result: Dictionary = job.result
-	if not result or result.is_empty():
-		# No mesh data - region might be empty
-		region.is_dirty = false
-		return
-
-	var combined_arrays: Array = result.get("combined_arrays", [])
-	if combined_arrays.is_empty() or combined_arrays[Mesh.ARRAY_VERTEX] == null:
-		# No geometry - region is empty
-		region.is_dirty = false
-		return
-
-	# CRITICAL FIX: Instead of creating the mesh immediately (which can cause 4+ second stalls),
-	# queue it for deferred creation. This spreads mesh creation over multiple frames.
-	var mesh_data := {
-		"region_pos": region_pos,
-		"region": region,
-		"combined_arrays": combined_arrays,
-		"vertex_count": result.get("vertex_count", 0),
-		"chunk_count": result.get("chunk_count", 0),
-		"cache_hits": result.get("cache_hits", 0),
-		"cache_misses": result.get("cache_misses", 0)
-	}
-
-	pending_mesh_creations.append(mesh_data)
+## Finish a mesh that produced no geometry: a rebuilt chunk that lost all its faces
+## releases its region slot (or frees its old mesh instance), then becomes active
+func _finish_chunk_without_geometry(chunk: Chunk) -> void:
+	if enable_region_batching:
+		if _get_chunk_region(chunk.position):
+			chunk.cached_mesh_arrays = []
+			chunk.cached_translucent_arrays = []
+			pending_chunk_uploads[chunk.position] = true
+	else:
+		var old_mesh = chunk.get_meta("old_mesh_instance", null)
+		if chunk.has_meta("old_mesh_instance"):
+			chunk.remove_meta("old_mesh_instance")
+		if old_mesh and is_instance_valid(old_mesh):
+			remove_child(old_mesh)
+			old_mesh.queue_free()
+		chunk.mesh_instance = null
 
-	# Mark region as no longer dirty
-	region.is_dirty = false
+	chunk.state = Chunk.State.ACTIVE
+	chunk.mark_clean()
 
 ## Tracked position for priority calculations (set by update_chunks)
 var tracked_position: Vector3 = Vector3.ZERO
 
+## Tracked camera forward for priority calculations (set by update_chunks)
+var tracked_camera_forward: Vector3 = Vector3.FORWARD
+
 ## Update frustum culling for all active chunks
-## Shows/hides chunks based on camera frustum visibility
+## Shows/hides regions (or chunks) based on camera frustum visibility
 ## Also applies occlusion culling if enabled
 func update_frustum_culling(camera: Camera3D) -> void:
 	if not camera:
 		return
 
-	var frustum := camera.get_frustum()
-
 	# Update occlusion culling first
-	if occlusion_culler and occlusion_culler.mode != OcclusionCuller.Mode.DISABLED:
+	var occlusion_enabled := occlusion_culler and occlusion_culler.mode != OcclusionCuller.Mode.DISABLED
+	if occlusion_enabled:
 		occlusion_culler.update_visibility(camera.global_position, active_chunks)
 
-	# OPTIMIZATION: Spread frustum culling over multiple frames
-	# Instead of checking ALL regions/chunks every frame (causes 180-250ms stalls),
-	# check only a subset per frame (reduces to ~45-60ms)
-	frustum_cull_frame_counter = (frustum_cull_frame_counter + 1) % FRUSTUM_CULL_FRAMES
+	# Full-coverage frustum test over the bounds table
+	frustum_culler.cull(camera.get_frustum())
 
-	# Region batching mode: Cull at region level
 	if enable_region_batching:
-		_update_region_culling(frustum)
-	else:
-		# Traditional mode: Cull individual chunks
-		_update_chunk_culling(frustum)
-
-## Update culling for regions (batched mode)
-## OPTIMIZED: Only checks a subset of regions per frame to avoid stalls
-func _update_region_culling(frustum: Array[Plane]) -> void:
-	var visible_count := 0
-	var hidden_count := 0
-	var checked_count := 0
-
-	# OPTIMIZATION: Only check 1/FRUSTUM_CULL_FRAMES of regions this frame
-	# This spreads the work over multiple frames to prevent 180-250ms stalls
-	# FIXED: Use regions_array instead of active_regions.values() for consistent iteration
-	var region_count := regions_array.size()
-	for region_index in range(region_count):
-		# Only check this region if it's this frame's turn (mod-based distribution)
-		if (region_index % FRUSTUM_CULL_FRAMES) != frustum_cull_frame_counter:
-			continue
-
-		var region: ChunkRegion = regions_array[region_index]
-		if not region or not region.mesh_instance:
-			continue
-
-		checked_count += 1
-
-		# Get region AABB (now cached!)
-		var aabb: AABB = region.get_aabb()
-
-		# Check frustum visibility
-		var is_frustum_visible := _aabb_intersects_frustum(aabb, frustum)
-
-		# For regions, occlusion culling is less useful (regions are large)
-		# We'll keep it simple and only use frustum culling at region level
-
-		# Update visibility
-		if region.mesh_instance.visible != is_frustum_visible:
-			region.mesh_instance.visible = is_frustum_visible
-
-		if is_frustum_visible:
-			visible_count += 1
-		else:
-			hidden_count += 1
-
-## Update culling for individual chunks (traditional mode)
-## OPTIMIZED: Only checks a subset of chunks per frame to avoid stalls
-func _update_chunk_culling(frustum: Array[Plane]) -> void:
-	var frustum_visible_count := 0
-	var frustum_hidden_count := 0
-	var occlusion_hidden_count := 0
-	var checked_count := 0
-
-	# OPTIMIZATION: Only check 1/FRUSTUM_CULL_FRAMES of chunks this frame
-	# This spreads the work over multiple frames to prevent stalls
-	var chunk_index := 0
-	for chunk in active_chunks.values():
-		if not chunk or not chunk.mesh_instance:
-			chunk_index += 1
-			continue
-
-		# Only check this chunk if it's this frame's turn (mod-based distribution)
-		if (chunk_index % FRUSTUM_CULL_FRAMES) != frustum_cull_frame_counter:
-			chunk_index += 1
-			continue
-
-		checked_count += 1
-
-		# Get chunk AABB
-		var aabb: AABB = chunk.get_aabb()
-
-		# Check frustum visibility
-		var is_frustum_visible := _aabb_intersects_frustum(aabb, frustum)
-
-		# Check occlusion visibility (if enabled)
-		var is_occluded := false
-		if occlusion_culler and occlusion_culler.mode != OcclusionCuller.Mode.DISABLED:
-			is_occluded = not occlusion_culler.is_chunk_visible(chunk.position)
-
-		# Final visibility = frustum visible AND not occluded
-		var is_visible := is_frustum_visible and not is_occluded
+		_update_translucent_order(camera.global_position)
 
-		# Update visibility
-		if chunk.mesh_instance.visible != is_visible:
-			chunk.mesh_instance.visible = is_visible
-
-		# Track stats
-		if is_frustum_visible:
-			frustum_visible_count += 1
-			if is_occluded:
-				occlusion_hidden_count += 1
-		else:
-			frustum_hidden_count += 1
-
-		chunk_index += 1
-
-	# Optionally log culling stats (can be disabled for performance)
-	# print("[ChunkManager] Culling: %d frustum visible, %d frustum hidden, %d occluded" % [frustum_visible_count, frustum_hidden_count, occlusion_hidden_count])
-
-## Check if an AABB intersects with a camera frustum
-func _aabb_intersects_frustum(aabb: AABB, frustum: Array[Plane]) -> bool:
-	# Test AABB against each frustum plane
-	for plane in frustum:
-		var p := aabb.position
-		var s := aabb.size
-
-		# Calculate the n-vertex (nearest point to the plane)
-		# This is the corner of the AABB closest to the plane
-		var n_vertex := Vector3(
-			p.x + (0 if plane.normal.x > 0 else s.x),
-			p.y + (0 if plane.normal.y > 0 else s.y),
-			p.z + (0 if plane.normal.z > 0 else s.z)
-		)
-
-		# If the nearest vertex is outside the plane, the entire AABB is outside
-		if plane.is_point_over(n_vertex):
-			return false
+	if occlusion_enabled:
+		# Occlusion results can change without the frustum changing - reapply every slot
+		for slot in range(_cull_slot_owners.size()):
+			if _cull_slot_owners[slot] != null:
+				_apply_cull_visibility(slot, true)
+	else:
+		for slot in frustum_culler.get_changed_slots():
+			_apply_cull_visibility(slot, false)
+
+## Apply the culling result of one slot to its region or chunk mesh instance
+func _apply_cull_visibility(slot: int, use_occlusion: bool) -> void:
+	var slot_owner = _cull_slot_owners[slot]
+	var is_visible := frustum_culler.is_visible(slot)
+
+	# Regions toggle their own node, which hides both the opaque and the translucent instance
+	var target: Node3D = null
+	if slot_owner is ChunkRegion:
+		target = slot_owner
+		# A region is drawn if any of its chunks is reachable from the camera
+		if is_visible and use_occlusion:
+			is_visible = false
+			for chunk_pos in slot_owner.chunks:
+				if occlusion_culler.is_chunk_visible(chunk_pos):
+					is_visible = true
+					break
+	elif slot_owner is Chunk:
+		target = slot_owner.mesh_instance
+		if is_visible and use_occlusion:
+			is_visible = occlusion_culler.is_chunk_visible(slot_owner.position)
+	elif slot_owner is LodTile:
+		target = slot_owner.mesh_instance
+
+	if target and target.visible != is_visible:
+		target.visible = is_visible
+
+## Radius around the player drawn by chunks or LOD tiles, left open by the far terrain
+## Without LOD tiles it is the circle inside the loaded chunk diamond
+func _get_far_terrain_inner_radius() -> float:
+	if lod_manager:
+		return float(lod_distance * VoxelData.CHUNK_SIZE_XZ)
+	return render_distance * VoxelData.CHUNK_SIZE_XZ * 0.7
+
+## Re-sort every region's translucent slots back-to-front when the camera enters another
+## region, and the regions that received an out-of-order translucent slot since the last sort
+func _update_translucent_order(camera_position: Vector3) -> void:
+	var camera_region := ChunkRegion.chunk_to_region_position(ChunkHeightZones.world_to_chunk_position(camera_position))
+	if camera_region != _translucent_sort_region:
+		_translucent_sort_region = camera_region
+		for region in regions_array:
+			region.sort_translucent(camera_position)
+	else:
+		for region_pos in _translucent_unsorted_regions:
+			var region: ChunkRegion = active_regions.get(region_pos)
+			if region:
+				region.sort_translucent(camera_position)
+	_translucent_unsorted_regions.clear()
+
+## Register a region or chunk bounds box for culling, returns its slot
+func _add_cull_slot(slot_owner, aabb: AABB) -> int:
+	var slot := frustum_culler.add(aabb)
+	if slot >= _cull_slot_owners.size():
+		_cull_slot_owners.resize(slot + 1)
+	_cull_slot_owners[slot] = slot_owner
+	return slot
+
+## Release a culling slot
+func _remove_cull_slot(slot: int) -> void:
+	if slot < 0:
+		return
+	frustum_culler.remove(slot)
+	_cull_slot_owners[slot] = null
 
-	# AABB intersects or is inside the frustum
-	return true
+## Register a chunk with an individual mesh instance for culling (non-batched mode)
+func _register_chunk_culling(chunk: Chunk) -> void:
+	if chunk.cull_slot < 0:
+		chunk.cull_slot = _add_cull_slot(chunk, chunk.get_aabb())
+	else:
+		# Rebuilt mesh instance - start it with the current culling result
+		chunk.mesh_instance.visible = frustum_culler.is_visible(chunk.cull_slot)
 
 ## Calculate which chunks should be loaded based on render distance
 ## Returns chunks in RADIAL ORDER (closest to player first) for optimal loading
@@ -680,7 +749,8 @@ func _initial_load_chunks(player_position: Vector3, camera_forward: Vector3) ->
 
 	for chunk_pos in _initial_load_queue:
 		# Skip if already loaded or being processed
-		if chunk_pos in active_chunks or chunk_pos in generating_chunks or chunk_pos in meshing_chunks:
+		if active_chunks.has(chunk_pos) or chunk_pos in generating_chunks or chunk_pos in meshing_chunks \
+				or chunk_pos in loading_chunks:
 			chunks_to_remove.append(chunk_pos)
 			continue
 
@@ -718,13 +788,26 @@ func _initial_load_chunks(player_position: Vector3, camera_forward: Vector3) ->
 func _unload_distant_chunks(needed_chunks: Dictionary) -> void:
 	var chunks_to_remove: Array[Vector3i] = []
 
-	for chunk_pos in active_chunks.keys():
+	for chunk_pos in active_chunks.get_positions():
 		if not needed_chunks.has(chunk_pos):
 			chunks_to_remove.append(chunk_pos)
 
 	for chunk_pos in chunks_to_remove:
 		unload_chunk(chunk_pos)
 
+	# Cancel queued terrain generation for chunks that fell out of range
+	for chunk_pos in generating_chunks.keys():
+		if not needed_chunks.has(chunk_pos):
+			_cancel_chunk_job(chunk_pos)
+			generating_chunks.erase(chunk_pos)
+
+	# Drop pending cache reads for chunks that fell out of range
+	for chunk_pos in loading_chunks.keys():
+		if not needed_chunks.has(chunk_pos):
+			chunk_cache.cancel_load(chunk_pos)
+			_cancel_chunk_job(chunk_pos)
+			loading_chunks.erase(chunk_pos)
+
 ## Load chunks that aren't loaded yet (old version, kept for compatibility)
 func _load_new_chunks(needed_chunks: Dictionary) -> void:
 	for chunk_pos in needed_chunks.keys():
@@ -799,7 +882,8 @@ func _process_load_queue() -> void:
 
 	for chunk_pos in load_queue:
 		# Skip if already loaded or being processed
-		if chunk_pos in active_chunks or chunk_pos in generating_chunks or chunk_pos in meshing_chunks:
+		if active_chunks.has(chunk_pos) or chunk_pos in generating_chunks or chunk_pos in meshing_chunks \
+				or chunk_pos in loading_chunks:
 			chunks_to_remove.append(chunk_pos)
 			continue
 
@@ -864,13 +948,62 @@ func _calculate_chunk_priority(chunk_pos: Vector3i, player_position: Vector3, ca
 
 	return priority
 
+## Calculate thread pool priority for a job centered at a world position
+## Inverse distance to the player, halved for work behind the camera
+## (same scale as ChunkThreadPool.URGENT_PRIORITY: >= 1/32 means within ~2 chunks)
+func _calculate_job_priority(world_center: Vector3) -> float:
+	var to_target := world_center - tracked_position
+	var priority: float = 1.0 / max(to_target.length(), 1.0)
+	if tracked_camera_forward.dot(to_target) < 0.0:
+		priority *= 0.5
+	return priority
+
+## Re-score a queued job against the latest tracked position and camera forward
+## Returns a negative score for jobs whose chunk is no longer wanted (cancels them)
+func _score_job(job: ChunkThreadPool.ChunkJob) -> float:
+	match job.job_type:
+		ChunkThreadPool.JobType.GENERATE_TERRAIN:
+			if not generating_chunks.has(job.chunk_pos):
+				return -1.0
+			return _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(job.chunk_pos).get_center())
+		ChunkThreadPool.JobType.BUILD_MESH:
+			if meshing_chunks.get(job.chunk_pos) != job.chunk:
+				return -1.0
+			return _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(job.chunk_pos).get_center())
+		ChunkThreadPool.JobType.BUILD_LOD:
+			if not lod_manager:
+				return -1.0
+			return lod_manager.score_job(job)
+		ChunkThreadPool.JobType.COMPUTE_LIGHT:
+			if not loading_chunks.has(job.chunk_pos):
+				return -1.0
+			return _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(job.chunk_pos).get_center())
+	return job.priority
+
+## Queue a meshing job for a chunk and keep its handle (replaces any older queued job)
+## With region batching the mesh is built region-local, ready for its region slot
+func _queue_chunk_meshing(chunk: Chunk) -> void:
+	_cancel_chunk_job(chunk.position)
+	chunk.meshed_neighbor_mask = chunk.neighbor_mask
+	var priority := _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(chunk.position).get_center())
+	var mesh_offset := ChunkRegion.get_chunk_mesh_offset(chunk.position) if enable_region_batching else Vector3.ZERO
+	chunk_jobs[chunk.position] = thread_pool.queue_meshing_job(chunk, mesh_builder, priority, mesh_offset)
+
+## Cancel the queued job for a chunk position (if any)
+func _cancel_chunk_job(chunk_pos: Vector3i) -> void:
+	var job: ChunkThreadPool.ChunkJob = chunk_jobs.get(chunk_pos)
+	if job and thread_pool:
+		thread_pool.cancel_job(job)
+	chunk_jobs.erase(chunk_pos)
+
 ## Load a single chunk at the given position
 func load_chunk(chunk_pos: Vector3i) -> Chunk:
 	# Check if already loaded, generating, or meshing
-	if chunk_pos in active_chunks:
-		return active_chunks[chunk_pos]
+	var loaded := active_chunks.get_chunk(chunk_pos)
+	if loaded:
+		return loaded
 
-	if chunk_pos in generating_chunks or chunk_pos in meshing_chunks:
+	if chunk_pos in generating_chunks or chunk_pos in meshing_chunks or chunk_pos in loading_chunks:
 		return null  # Already being processed
 
 	# Try threading path first
@@ -887,29 +1020,75 @@ func _load_chunk_threaded(chunk_pos: Vector3i) -> Chunk:
 	if thread_pool and thread_pool.get_pending_job_count() > MAX_PENDING_JOBS:
 		return null
 
-	# Try to load from cache first
-	var chunk: Chunk = null
+	# Ask the cache first - the read happens on its I/O thread and
+	# _process_cache_loads continues with meshing (hit) or generation (miss)
+	if chunk_cache and chunk_cache.request_load(chunk_pos):
+		loading_chunks[chunk_pos] = true
+		return null
 
-	if chunk_cache and chunk_cache.has_cached_chunk(chunk_pos):
-		chunk = chunk_cache.load_chunk(chunk_pos)
-		if chunk:
-			# Cached chunk loaded - skip generation, go straight to meshing
-			active_chunks[chunk_pos] = chunk
-			_update_chunk_neighbors(chunk_pos, chunk)
-
-			# Queue mesh building
-			chunk.state = Chunk.State.MESHING
-			meshing_chunks[chunk_pos] = chunk
-			var priority: float = 1.0 / max(tracked_position.distance_to(chunk.get_world_position()), 1.0)
-			thread_pool.queue_meshing_job(chunk, mesh_builder, priority)
-			return chunk
-
-	# Not cached - queue terrain generation
-	generating_chunks[chunk_pos] = true
-	var priority: float = 1.0 / max(tracked_position.distance_to(Vector3(chunk_pos * VoxelData.CHUNK_SIZE_XZ)), 1.0)
-	thread_pool.queue_generation_job(chunk_pos, terrain_generator, priority)
+	_queue_chunk_generation(chunk_pos)
 	return null
 
+## Queue a terrain generation job for a chunk and keep its handle
+func _queue_chunk_generation(chunk_pos: Vector3i) -> void:
+	generating_chunks[chunk_pos] = true
+	var priority := _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(chunk_pos).get_center())
+	chunk_jobs[chunk_pos] = thread_pool.queue_generation_job(chunk_pos, terrain_generator, priority, light_engine != null)
+
+## Process finished cache reads
+func _process_cache_loads() -> void:
+	for result in chunk_cache.poll_loaded(max_jobs_per_frame * 4):
+		var chunk_pos: Vector3i = result.chunk_pos
+		if not loading_chunks.has(chunk_pos):
+			continue
+		loading_chunks.erase(chunk_pos)
+
+		var chunk: Chunk = result.chunk
+		if not chunk:
+			# Cache miss - generate terrain instead
+			_queue_chunk_generation(chunk_pos)
+			continue
+
+		# Cached chunk loaded - skip generation; light it on a worker first (the cache
+		# holds no light), staying in loading_chunks until the light job lands
+		if light_engine and terrain_generator:
+			loading_chunks[chunk_pos] = true
+			var priority := _calculate_job_priority(ChunkHeightZones.get_chunk_world_bounds(chunk_pos).get_center())
+			chunk_jobs[chunk_pos] = thread_pool.queue_light_job(chunk, terrain_generator, priority)
+			continue
+
+		_activate_cached_chunk(chunk, null)
+
+## Handle completed light job for a chunk read from the cache
+func _on_light_completed(job) -> void:
+	var chunk_pos: Vector3i = job.chunk_pos
+	if chunk_jobs.get(chunk_pos) != job or not loading_chunks.has(chunk_pos):
+		return  # Unloaded (or re-requested) while lighting
+	chunk_jobs.erase(chunk_pos)
+	loading_chunks.erase(chunk_pos)
+
+	if job.error:
+		push_error("[ChunkManager] Light error for chunk %s: %s" % [chunk_pos, job.error])
+		return
+
+	_activate_cached_chunk(job.chunk, job.light)
+
+## Make a cached chunk active, stitch its light and go straight to meshing
+func _activate_cached_chunk(chunk: Chunk, light: ChunkLight) -> void:
+	var chunk_pos := chunk.position
+	active_chunks.insert(chunk_pos, chunk)
+	_update_chunk_neighbors(chunk_pos, chunk)
+	if light_engine:
+		_light_activated_chunk(chunk, light)
+
+	if not _is_chunk_meshable(chunk):
+		_wait_for_neighbors(chunk)
+		return
+
+	chunk.state = Chunk.State.MESHING
+	meshing_chunks[chunk_pos] = chunk
+	_queue_chunk_meshing(chunk)
+
 ## Load chunk synchronously (fallback when threading disabled)
 func _load_chunk_sync(chunk_pos: Vector3i) -> Chunk:
 	# Try to load from cache first
@@ -943,13 +1122,24 @@ func _load_chunk_sync(chunk_pos: Vector3i) -> Chunk:
 		return null
 
 	# Add to active chunks first (before neighbor updates)
-	active_chunks[chunk_pos] = chunk
+	active_chunks.insert(chunk_pos, chunk)
 
 	# Update neighbor references BEFORE building mesh
 	# This allows proper face culling at chunk boundaries
 	# print("[ChunkManager]   Updating neighbor references...")
 	_update_chunk_neighbors(chunk_pos, chunk)
 
+	if light_engine and terrain_generator:
+		var light: ChunkLight = null
+		if not chunk.voxel_data.is_enclosed:
+			light = LightEngine.compute_chunk_light(chunk.voxel_data, terrain_generator)
+		_light_activated_chunk(chunk, light)
+
+	# Buried stone and deep water have nothing to mesh
+	if chunk.voxel_data.is_enclosed:
+		_activate_enclosed_chunk(chunk)
+		return chunk
+
 	# Generate mesh
 	chunk.state = Chunk.State.MESHING
 	if mesh_builder:
@@ -960,6 +1150,7 @@ func _load_chunk_sync(chunk_pos: Vector3i) -> Chunk:
 				chunk.mesh_instance = mesh_instance
 				mesh_instance.position = chunk.get_world_position()
 				add_child(mesh_instance)
+				_register_chunk_culling(chunk)
 				stats_chunks_meshed += 1
 
 	# Activate chunk
@@ -967,6 +1158,8 @@ func _load_chunk_sync(chunk_pos: Vector3i) -> Chunk:
 
 	# Add chunk to region (if region batching enabled)
 	if enable_region_batching:
+		if mesh_builder:
+			_build_region_arrays_sync(chunk)
 		_add_chunk_to_region(chunk)
 
 	# Mark occlusion graph as dirty (new chunk added)
@@ -980,6 +1173,45 @@ func _load_chunk_sync(chunk_pos: Vector3i) -> Chunk:
 	# print("[ChunkManager] ✓ Chunk %s loaded successfully" % chunk_pos)
 	return chunk
 
+## Activate a generated chunk without meshing it (VoxelData.is_enclosed: no visible faces)
+## Neighbors are still rebuilt, since faces they drew toward the missing chunk are now hidden
+func _activate_enclosed_chunk(chunk: Chunk) -> void:
+	var is_opaque := not VoxelTypes.is_transparent(chunk.voxel_data.get_voxel(Vector3i.ZERO))
+	chunk.face_connectivity = BinaryGreedyMesher.CONNECTIVITY_NONE if is_opaque else BinaryGreedyMesher.CONNECTIVITY_ALL
+	chunk.state = Chunk.State.ACTIVE
+	chunk.mark_clean()
+	stats_chunks_enclosed += 1
+
+	if occlusion_culler:
+		occlusion_culler.mark_graph_dirty()
+
+	_rebuild_neighbor_meshes(chunk.position)
+
+## Give a newly active chunk its light (dark storage if none was computed, e.g. enclosed
+## chunks) and exchange light with its loaded neighbors
+func _light_activated_chunk(chunk: Chunk, light: ChunkLight) -> void:
+	chunk.light = light if light else ChunkLight.new(chunk.voxel_data.get_chunk_volume())
+	light_engine.on_chunk_loaded(chunk)
+
+	# The chunk itself is about to be meshed with its new light
+	var changed := light_engine.take_changed_chunks()
+	changed.erase(chunk.position)
+	_queue_light_rebuilds(changed)
+
+## Remesh active chunks whose baked light changed (batched with the neighbor rebuilds)
+## Chunks already meshing are re-queued right away, as in commit(): their in-flight job
+## snapshotted the old light
+func _queue_light_rebuilds(changed: Dictionary) -> void:
+	for chunk_pos in changed:
+		var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+		if not chunk or chunk.voxel_data.is_enclosed:
+			continue
+		if chunk.state == Chunk.State.ACTIVE:
+			pending_neighbor_rebuilds[chunk_pos] = true
+		elif chunk.state == Chunk.State.MESHING:
+			pending_neighbor_rebuilds.erase(chunk_pos)
+			_rebuild_chunk_mesh(chunk)
+
 ## Build chunk mesh synchronously
 func _build_chunk_mesh_sync(chunk: Chunk) -> void:
 	if not mesh_builder or not chunk:
@@ -990,6 +1222,7 @@ func _build_chunk_mesh_sync(chunk: Chunk) -> void:
 		chunk.mesh_instance = mesh_instance
 		mesh_instance.position = chunk.get_world_position()
 		add_child(mesh_instance)
+		_register_chunk_culling(chunk)
 		stats_chunks_meshed += 1
 
 	chunk.state = Chunk.State.ACTIVE
@@ -1003,12 +1236,19 @@ func _build_chunk_mesh_sync(chunk: Chunk) -> void:
 
 ## Unload a chunk at the given position
 func unload_chunk(chunk_pos: Vector3i) -> void:
-	if chunk_pos not in active_chunks:
+	if not active_chunks.has(chunk_pos):
 		return
 
-	var chunk: Chunk = active_chunks[chunk_pos]
+	var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
 	chunk.state = Chunk.State.UNLOADING
 
+	neighbor_wait_chunks.erase(chunk_pos)
+
+	# Cancel any queued meshing job - its result would be discarded anyway
+	if meshing_chunks.has(chunk_pos):
+		_cancel_chunk_job(chunk_pos)
+		meshing_chunks.erase(chunk_pos)
+
 	# Save to cache before unloading (if not empty)
 	if chunk_cache and not chunk.is_empty():
 		if not chunk_cache.is_cache_full():
@@ -1030,6 +1270,10 @@ func unload_chunk(chunk_pos: Vector3i) -> void:
 	# Clear neighbor references
 	_clear_chunk_neighbors(chunk_pos)
 
+	# Release culling slot (non-batched mode)
+	_remove_cull_slot(chunk.cull_slot)
+	chunk.cull_slot = -1
+
 	# Remove from active chunks
 	active_chunks.erase(chunk_pos)
 
@@ -1055,134 +1299,50 @@ func _return_chunk_to_pool(chunk: Chunk) -> void:
 		chunk.cleanup()
 		chunk_pool.append(chunk)
 
-## Update neighbor references for a chunk and its neighbors
+## Link a newly active chunk and its loaded face neighbors both ways
 func _update_chunk_neighbors(chunk_pos: Vector3i, chunk: Chunk) -> void:
-	# Define neighbor offsets
-	var neighbor_offsets := {
-		"north": Vector3i(0, 0, 1),
-		"south": Vector3i(0, 0, -1),
-		"east": Vector3i(1, 0, 0),
-		"west": Vector3i(-1, 0, 0),
-		"up": Vector3i(0, 1, 0),
-		"down": Vector3i(0, -1, 0)
-	}
+	for face in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		var neighbor := active_chunks.get_chunk(chunk_pos + Chunk.NEIGHBOR_OFFSETS[face])
+		if neighbor:
+			chunk.set_neighbor(face, neighbor)
+			neighbor.set_neighbor(face ^ 1, chunk)
 
-	# Set this chunk's neighbors
-	for direction in neighbor_offsets.keys():
-		var neighbor_pos: Vector3i = chunk_pos + neighbor_offsets[direction]
-		if neighbor_pos in active_chunks:
-			chunk.set_neighbor(direction, active_chunks[neighbor_pos])
-
-	# Update neighbors to reference this chunk
-	var opposite := {
-		"north": "south",
-		"south": "north",
-		"east": "west",
-		"west": "east",
-		"up": "down",
-		"down": "up"
-	}
-
-	for direction in neighbor_offsets.keys():
-		var neighbor_pos: Vector3i = chunk_pos + neighbor_offsets[direction]
-		if neighbor_pos in active_chunks:
-			var neighbor: Chunk = active_chunks[neighbor_pos]
-			neighbor.set_neighbor(opposite[direction], chunk)
-
-## Clear neighbor references when unloading a chunk
+## Unlink a chunk that is unloading from its neighbors
 func _clear_chunk_neighbors(chunk_pos: Vector3i) -> void:
-	var chunk: Chunk = active_chunks.get(chunk_pos)
+	var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
 	if not chunk:
 		return
 
-	# Clear this chunk's neighbor references
-	for key in chunk.neighbors.keys():
-		chunk.neighbors[key] = null
-
-	# Remove references from neighbors pointing to this chunk
-	var neighbor_offsets := {
-		"north": Vector3i(0, 0, 1),
-		"south": Vector3i(0, 0, -1),
-		"east": Vector3i(1, 0, 0),
-		"west": Vector3i(-1, 0, 0),
-		"up": Vector3i(0, 1, 0),
-		"down": Vector3i(0, -1, 0)
-	}
-
-	var opposite := {
-		"north": "south",
-		"south": "north",
-		"east": "west",
-		"west": "east",
-		"up": "down",
-		"down": "up"
-	}
-
-	for direction in neighbor_offsets.keys():
-		var neighbor_pos: Vector3i = chunk_pos + neighbor_offsets[direction]
-		if neighbor_pos in active_chunks:
-			var neighbor: Chunk = active_chunks[neighbor_pos]
-			neighbor.set_neighbor(opposite[direction], null)
+	for face in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		var neighbor := chunk.get_neighbor(face)
+		if neighbor:
+			neighbor.set_neighbor(face ^ 1, null)
+	chunk.clear_neighbors()
 
 ## Rebuild meshes of neighboring chunks
-## Called when a new chunk is loaded to ensure proper face culling at boundaries
+## Called when a chunk is loaded or unloaded to ensure proper face culling at boundaries
 ## Now uses batched rebuilds to prevent duplicate work in the same frame
+## Neighbors whose last mesh snapshot already saw this chunk's current link state
+## (Chunk.meshed_neighbor_mask) are skipped - they were meshed after it arrived
 func _rebuild_neighbor_meshes(chunk_pos: Vector3i) -> void:
-	# OPTIMIZATION: In region batching mode, don't rebuild individual chunk meshes!
-	# Instead, mark the affected neighbor regions as dirty
-	if enable_region_batching:
-		var neighbor_offsets := {
-			"north": Vector3i(0, 0, 1),
-			"south": Vector3i(0, 0, -1),
-			"east": Vector3i(1, 0, 0),
-			"west": Vector3i(-1, 0, 0),
-			"up": Vector3i(0, 1, 0),
-			"down": Vector3i(0, -1, 0)
-		}
-
-		for direction in neighbor_offsets.keys():
-			var neighbor_pos: Vector3i = chunk_pos + neighbor_offsets[direction]
-			if neighbor_pos in active_chunks:
-				# Mark the neighbor chunk's cached mesh arrays as invalid
-				var neighbor: Chunk = active_chunks[neighbor_pos]
-				if neighbor and neighbor.state == Chunk.State.ACTIVE:
-					neighbor.cached_mesh_arrays.clear()
-
-				# Mark the region containing this neighbor as dirty
-				var neighbor_region_pos := ChunkRegion.chunk_to_region_position(neighbor_pos)
-				if neighbor_region_pos in active_regions:
-					var region: ChunkRegion = active_regions[neighbor_region_pos]
-					if region:
-						region.mark_dirty()
-		return
-
-	# Traditional mode: Queue individual chunk mesh rebuilds
-	var neighbor_offsets := {
-		"north": Vector3i(0, 0, 1),
-		"south": Vector3i(0, 0, -1),
-		"east": Vector3i(1, 0, 0),
-		"west": Vector3i(-1, 0, 0),
-		"up": Vector3i(0, 1, 0),
-		"down": Vector3i(0, -1, 0)
-	}
-
+	# Queue individual chunk mesh rebuilds (with region batching, each rebuilt
+	# neighbor re-uploads only its own region slot)
 	# Instead of rebuilding immediately, queue neighbors for batched rebuild
 	# This prevents the same neighbor from being rebuilt multiple times in one frame
-	for direction in neighbor_offsets.keys():
-		var neighbor_pos: Vector3i = chunk_pos + neighbor_offsets[direction]
-		if neighbor_pos in active_chunks:
-			var neighbor: Chunk = active_chunks[neighbor_pos]
-			if neighbor and neighbor.state == Chunk.State.ACTIVE:
-				# Add to pending rebuilds (dictionary acts as a set, avoids duplicates)
-				pending_neighbor_rebuilds[neighbor_pos] = true
+	for face in range(Chunk.NEIGHBOR_OFFSETS.size()):
+		var neighbor_pos := chunk_pos + Chunk.NEIGHBOR_OFFSETS[face]
+		var neighbor: Chunk = active_chunks.get_chunk(neighbor_pos)
+		# Enclosed chunks have no faces whatever their neighbors hold
+		if neighbor and neighbor.state == Chunk.State.ACTIVE and not neighbor.voxel_data.is_enclosed:
+			var slot_bit := 1 << (face ^ 1)
+			if neighbor.meshed_neighbor_mask >= 0 and (neighbor.meshed_neighbor_mask & slot_bit) == (neighbor.neighbor_mask & slot_bit):
+				continue
+			# Add to pending rebuilds (dictionary acts as a set, avoids duplicates)
+			pending_neighbor_rebuilds[neighbor_pos] = true
 
 ## Process batched neighbor rebuilds
 ## Processes up to a limited number per frame to avoid FPS spikes
 func _process_pending_neighbor_rebuilds() -> void:
-	# Not used in region batching mode
-	if enable_region_batching:
-		return
-
 	if pending_neighbor_rebuilds.is_empty():
 		return
 
@@ -1197,8 +1357,8 @@ func _process_pending_neighbor_rebuilds() -> void:
 			break
 
 		# Check if chunk still exists and is active
-		if neighbor_pos in active_chunks:
-			var neighbor: Chunk = active_chunks[neighbor_pos]
+		var neighbor: Chunk = active_chunks.get_chunk(neighbor_pos)
+		if neighbor:
 			if neighbor and neighbor.state == Chunk.State.ACTIVE:
 				_rebuild_chunk_mesh(neighbor)
 				rebuilds_this_frame += 1
@@ -1210,14 +1370,23 @@ func _process_pending_neighbor_rebuilds() -> void:
 		pending_neighbor_rebuilds.erase(pos)
 
 ## Rebuild a single chunk's mesh
-func _rebuild_chunk_mesh(chunk: Chunk) -> void:
+## partial: the only changes since the last mesh are voxel edits and light changes marked
+## in chunk.dirty_slices, so a worker may re-mesh just those slices
+func _rebuild_chunk_mesh(chunk: Chunk, partial: bool = false) -> void:
 	if not chunk or not mesh_builder:
 		return
+	if not partial:
+		chunk.needs_full_mesh = true
+
+	# A chunk still meshing its first mesh has no old mesh, and is no rebuild: its first
+	# mesh must still rebuild the neighbors when it lands
+	var was_active := chunk.state == Chunk.State.ACTIVE
 
 	# IMPORTANT: Don't remove old mesh yet! Keep it visible to prevent flashing
 	# The old mesh will be replaced when the new one is ready
 	# Store reference to old mesh so we can clean it up later
-	chunk.set_meta("old_mesh_instance", chunk.mesh_instance)
+	if was_active:
+		chunk.set_meta("old_mesh_instance", chunk.mesh_instance)
 
 	# Build new mesh (use threading if available)
 	chunk.state = Chunk.State.MESHING
@@ -1226,9 +1395,15 @@ func _rebuild_chunk_mesh(chunk: Chunk) -> void:
 		# Queue threaded mesh rebuild (mark as rebuild to prevent cascading)
 		meshing_chunks[chunk.position] = chunk
 		# Store a flag in the chunk to indicate this is a rebuild, not initial load
-		chunk.set_meta("is_rebuild", true)
-		var priority: float = 1.0 / max(tracked_position.distance_to(chunk.get_world_position()), 1.0)
-		thread_pool.queue_meshing_job(chunk, mesh_builder, priority)
+		if was_active:
+			chunk.set_meta("is_rebuild", true)
+		_queue_chunk_meshing(chunk)
+	elif enable_region_batching:
+		# Fallback to synchronous rebuild into the chunk's region slot
+		_build_region_arrays_sync(chunk)
+		pending_chunk_uploads[chunk.position] = true
+		chunk.state = Chunk.State.ACTIVE
+		chunk.mark_clean()
 	else:
 		# Fallback to synchronous rebuild
 		var old_mesh = chunk.mesh_instance
@@ -1237,6 +1412,7 @@ func _rebuild_chunk_mesh(chunk: Chunk) -> void:
 			chunk.mesh_instance = mesh_instance
 			mesh_instance.position = chunk.get_world_position()
 			add_child(mesh_instance)
+			_register_chunk_culling(chunk)
 
 		# Now remove old mesh after new one is added
 		if old_mesh:
@@ -1249,7 +1425,11 @@ func _rebuild_chunk_mesh(chunk: Chunk) -> void:
 
 ## Get chunk at a specific chunk position
 func get_chunk(chunk_pos: Vector3i) -> Chunk:
-	return active_chunks.get(chunk_pos)
+	return active_chunks.get_chunk(chunk_pos)
+
+## Get the active chunks overlapping a world-space box
+func get_chunks_in_aabb(aabb: AABB) -> Array[Chunk]:
+	return active_chunks.get_chunks_in_box(world_to_chunk_position(aabb.position), world_to_chunk_position(aabb.end))
 
 ## Get voxel at world position
 func get_voxel_at_world(world_pos: Vector3i) -> int:
@@ -1263,14 +1443,138 @@ func get_voxel_at_world(world_pos: Vector3i) -> int:
 	return VoxelTypes.Type.AIR
 
 ## Set voxel at world position (and trigger mesh rebuild)
+## A one-voxel transaction - use begin_edit/set_voxels/commit for many voxels
 func set_voxel_at_world(world_pos: Vector3i, voxel_type: int) -> void:
+	begin_edit()
+	_buffer_edit(world_pos, voxel_type)
+	commit()
+
+## Open an edit transaction: voxel writes are buffered until the matching commit()
+## Transactions nest, and only the outermost commit applies the edits
+func begin_edit() -> void:
+	_edit_depth += 1
+
+## Set many voxels at world positions (voxel_types[i] goes to positions[i])
+## Buffered by the open transaction, or applied at once as a transaction of its own
+## Voxels outside active chunks are ignored
+func set_voxels(positions: Array[Vector3i], voxel_types: PackedByteArray) -> void:
+	if positions.size() != voxel_types.size():
+		push_error("[ChunkManager] set_voxels: %d positions but %d types" % [positions.size(), voxel_types.size()])
+		return
+
+	begin_edit()
+	for i in range(positions.size()):
+		_buffer_edit(positions[i], voxel_types[i])
+	commit()
+
+## Close an edit transaction; the outermost commit applies the buffered edits:
+## one batched write per chunk, one light update for all changed voxels, then exactly one
+## remesh per edited chunk, per neighbor sharing an edited boundary (faces and AO) and per
+## chunk whose light changed
+func commit() -> void:
+	if _edit_depth == 0:
+		push_warning("[ChunkManager] commit() without begin_edit()")
+		return
+	_edit_depth -= 1
+	if _edit_depth > 0 or _pending_edits.is_empty():
+		return
+
+	var edits_by_chunk := _pending_edits
+	_pending_edits = {}
+
+	var remesh: Dictionary = {}  # Chunk position -> true
+	var changed_positions: Array[Vector3i] = []
+	var old_types := PackedByteArray()
+	var new_types := PackedByteArray()
+
+	for chunk_pos in edits_by_chunk:
+		var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+		if not chunk or chunk.state == Chunk.State.UNLOADING:
+			continue
+
+		var edits: Dictionary = edits_by_chunk[chunk_pos]
+		var voxel_indices := PackedInt32Array(edits.keys())
+		var voxel_types := PackedByteArray(edits.values())
+		var previous := chunk.set_voxels(voxel_indices, voxel_types)
+
+		for i in range(voxel_indices.size()):
+			if previous[i] == voxel_types[i]:
+				continue
+			var local_pos := chunk.voxel_data.get_position_from_index(voxel_indices[i])
+			_mark_edit_remesh(remesh, chunk_pos, local_pos, chunk.voxel_data.chunk_size_y)
+			changed_positions.append(chunk.local_to_world(local_pos))
+			old_types.append(previous[i])
+			new_types.append(voxel_types[i])
+
+	if changed_positions.is_empty():
+		return
+
+	stats_edit_commits += 1
+	stats_voxels_edited += changed_positions.size()
+
+	# Edited boundaries expose faces of neighbors that were skipped as enclosed
+	for chunk_pos in remesh:
+		var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+		if chunk:
+			chunk.voxel_data.is_enclosed = false
+
+	# One light pass for the whole batch; relit chunks join the remesh set
+	if light_engine:
+		light_engine.on_voxels_changed(changed_positions, old_types, new_types)
+		for chunk_pos in light_engine.take_changed_chunks():
+			var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+			if chunk and not chunk.voxel_data.is_enclosed:
+				remesh[chunk_pos] = true
+
+	for chunk_pos in remesh:
+		var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+		if chunk and (chunk.state == Chunk.State.ACTIVE or chunk.state == Chunk.State.MESHING):
+			# A waiting neighbor rebuild changed more than the dirty slices - mesh it whole
+			var partial := not pending_neighbor_rebuilds.has(chunk_pos)
+			pending_neighbor_rebuilds.erase(chunk_pos)
+			_rebuild_chunk_mesh(chunk, partial)
+
+## Buffer one voxel write in the open transaction (dropped outside active chunks)
+func _buffer_edit(world_pos: Vector3i, voxel_type: int) -> void:
 	var chunk_pos := world_to_chunk_position(world_pos)
-	var chunk := get_chunk(chunk_pos)
+	var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+	if not chunk:
+		return
 
-	if chunk:
-		var local_pos := chunk.world_to_local(world_pos)
-		chunk.set_voxel(local_pos, voxel_type)
-		# TODO: Trigger mesh rebuild
+	var edits: Dictionary = _pending_edits.get(chunk_pos, {})
+	if edits.is_empty():
+		_pending_edits[chunk_pos] = edits
+	edits[chunk.voxel_data.get_index(chunk.world_to_local(world_pos))] = voxel_type
+
+## Mark the chunks whose meshes an edited voxel can change: its own chunk, plus every
+## neighbor (faces, edges and corners - AO reads diagonal cells) whose border it lies on
+## Each gets the slices around the voxel (in its own coordinates) marked dirty
+func _mark_edit_remesh(remesh: Dictionary, chunk_pos: Vector3i, local_pos: Vector3i, size_y: int) -> void:
+	var last := Vector3i(VoxelData.CHUNK_SIZE_XZ - 1, size_y - 1, VoxelData.CHUNK_SIZE_XZ - 1)
+	var low := Vector3i.ZERO
+	var high := Vector3i.ZERO
+	for axis in range(3):
+		if local_pos[axis] == 0:
+			low[axis] = -1
+		elif local_pos[axis] == last[axis]:
+			high[axis] = 1
+
+	for dx in range(low.x, high.x + 1):
+		for dy in range(low.y, high.y + 1):
+			for dz in range(low.z, high.z + 1):
+				var target_pos := chunk_pos + Vector3i(dx, dy, dz)
+				remesh[target_pos] = true
+				var target: Chunk = active_chunks.get_chunk(target_pos)
+				if not target:
+					continue
+
+				# The voxel in the target chunk's coordinates (just outside it for neighbors)
+				var target_local := local_pos - Vector3i(dx * VoxelData.CHUNK_SIZE_XZ, 0, dz * VoxelData.CHUNK_SIZE_XZ)
+				if dy > 0:
+					target_local.y -= size_y
+				elif dy < 0:
+					target_local.y += target.voxel_data.chunk_size_y
+				target.mark_slices_dirty(target_local)
 
 ## Convert world position to chunk position (uses adaptive chunk heights)
 func world_to_chunk_position(world_pos: Vector3) -> Vector3i:
@@ -1305,21 +1609,21 @@ func _check_initial_chunks_ready() -> void:
 
 	# Count active chunks
 	var active_count := 0
-	for chunk in active_chunks.values():
+	for chunk in active_chunks.get_chunks():
 		if chunk and chunk.state == Chunk.State.ACTIVE:
 			active_count += 1
 
-	# CRITICAL FIX: With region batching, chunks can be ACTIVE but meshes not yet created
-	# (they're in pending_mesh_creations queue). We need to ensure meshes are actually visible.
+	# CRITICAL FIX: With region batching, chunks can be ACTIVE but not yet uploaded
+	# (they're in the pending_chunk_uploads queue). We need to ensure meshes are actually visible.
 	if enable_region_batching:
 		# Check that we have enough active chunks AND meshes are actually created
 		var visible_regions := 0
 		for region in active_regions.values():
-			if region and region.mesh_instance and region.mesh_instance.visible:
+			if region and region.mesh_instance and region.visible:
 				visible_regions += 1
 
-		# Emit signal once we have enough chunks AND pending meshes are processed AND regions are visible
-		if active_count >= INITIAL_CHUNKS_THRESHOLD and pending_mesh_creations.is_empty() and visible_regions > 0:
+		# Emit signal once we have enough chunks AND pending uploads are processed AND regions are visible
+		if active_count >= INITIAL_CHUNKS_THRESHOLD and pending_chunk_uploads.is_empty() and visible_regions > 0:
 			_initial_chunks_ready = true
 			initial_chunks_ready.emit()
 			print("[ChunkManager] Initial chunks ready: %d active chunks, %d visible regions" % [active_count, visible_regions])
@@ -1338,6 +1642,12 @@ func reset_initial_load() -> void:
 
 ## Cleanup all chunks
 func cleanup_all() -> void:
+	# Release LOD tiles while their culling slots and queued jobs still exist
+	if lod_manager:
+		lod_manager.clear()
+	if far_terrain:
+		far_terrain.clear()
+
 	# Shutdown thread pool first
 	if thread_pool:
 		thread_pool.shutdown()
@@ -1346,9 +1656,12 @@ func cleanup_all() -> void:
 	# Clear job tracking
 	generating_chunks.clear()
 	meshing_chunks.clear()
+	chunk_jobs.clear()
+	loading_chunks.clear()
+	neighbor_wait_chunks.clear()
 
 	# Unload all chunks
-	var chunks_to_remove := active_chunks.keys()
+	var chunks_to_remove := active_chunks.get_positions()
 	for chunk_pos in chunks_to_remove:
 		unload_chunk(chunk_pos)
 
@@ -1362,16 +1675,20 @@ func cleanup_all() -> void:
 			region.cleanup()
 
 	active_regions.clear()
+	_translucent_unsorted_regions.clear()
 	regions_array.clear()
-	dirty_regions.clear()
+	pending_chunk_uploads.clear()
+	frustum_culler.clear()
+	_cull_slot_owners.clear()
 
 	# Reset initial load state
 	_is_initial_load = true
 	_initial_load_queue.clear()
 
-	# Print cache stats on cleanup
+	# Print cache stats on cleanup and release region file handles
 	if chunk_cache:
 		chunk_cache.print_stats()
+		chunk_cache.close()
 
 ## Get statistics for debugging
 func get_stats() -> Dictionary:
@@ -1380,8 +1697,16 @@ func get_stats() -> Dictionary:
 		"pooled_chunks": stats_pooled_chunks,
 		"chunks_generated": stats_chunks_generated,
 		"chunks_meshed": stats_chunks_meshed,
+		"chunks_enclosed": stats_chunks_enclosed,
+		"voxels_edited": stats_voxels_edited,
+		"partial_remeshes": stats_partial_remeshes,
+		"neighbor_waits": stats_neighbor_waits,
+		"waiting_chunks": neighbor_wait_chunks.size(),
 		"generating_chunks": generating_chunks.size(),
-		"meshing_chunks": meshing_chunks.size()
+		"loading_chunks": loading_chunks.size(),
+		"meshing_chunks": meshing_chunks.size(),
+		"pending_uploads": pending_chunk_uploads.size(),
+		"bytes_uploaded": stats_bytes_uploaded
 	}
 
 	# Add cache stats if available
@@ -1411,15 +1736,46 @@ func get_stats() -> Dictionary:
 		stats["occlusion_hidden"] = occlusion_stats.occluded_chunks
 		stats["occlusion_rate"] = occlusion_stats.occlusion_rate
 
+	# Add frustum culling stats
+	var frustum_stats := frustum_culler.get_stats()
+	stats["frustum_slots"] = frustum_stats.slots
+	stats["frustum_visible"] = frustum_stats.visible
+	stats["frustum_cull_ms"] = frustum_stats.last_cull_ms
+
 	# Add region batching stats if available
 	if enable_region_batching:
 		stats["region_batching_enabled"] = true
 		stats["active_regions"] = active_regions.size()
-		stats["dirty_regions"] = dirty_regions.size()
-		stats["rebuilding_regions"] = rebuilding_regions.size()
+		stats["pending_chunk_uploads"] = pending_chunk_uploads.size()
+		var region_vertices := 0
+		var region_memory := 0
+		for region in regions_array:
+			region_vertices += region.vertex_count
+			region_memory += region.get_memory_usage()
+		stats["region_vertices"] = region_vertices
+		stats["region_buffer_mb"] = region_memory / (1024.0 * 1024.0)
 	else:
 		stats["region_batching_enabled"] = false
 
+	# Add LOD stats if available
+	if lod_manager:
+		var lod_stats := lod_manager.get_stats()
+		stats["lod_tiles"] = lod_stats.tiles
+		stats["lod_pending_tiles"] = lod_stats.pending_tiles
+		stats["lod_vertices"] = lod_stats.vertices
+
+	# Add far terrain stats if available
+	if far_terrain:
+		var far_stats := far_terrain.get_stats()
+		stats["far_terrain_rings"] = far_stats.rings
+		stats["far_terrain_reach"] = far_stats.reach
+
+	# Add lighting stats if available
+	if light_engine:
+		var light_stats := light_engine.get_stats()
+		stats["light_edits"] = light_stats.edits
+		stats["light_steps"] = light_stats.steps
+
 	return stats
 
 ## Print debug info
@@ -1427,10 +1783,15 @@ func print_stats() -> void:
 	print("ChunkManager Stats:")
 	print("  Active chunks: %d" % stats_active_chunks)
 	print("  Pooled chunks: %d" % stats_pooled_chunks)
+	print("  Loading from cache: %d" % loading_chunks.size())
 	print("  Generating: %d" % generating_chunks.size())
 	print("  Meshing: %d" % meshing_chunks.size())
+	print("  Pending uploads: %d (%.1f MB uploaded)" % [pending_chunk_uploads.size(), stats_bytes_uploaded / 1048576.0])
 	print("  Total generated: %d" % stats_chunks_generated)
 	print("  Total meshed: %d" % stats_chunks_meshed)
+	print("  Enclosed (not meshed): %d" % stats_chunks_enclosed)
+	print("  Waited for neighbors: %d (%d waiting)" % [stats_neighbor_waits, neighbor_wait_chunks.size()])
+	print("  Voxels edited: %d (%d commits, %d partial remeshes)" % [stats_voxels_edited, stats_edit_commits, stats_partial_remeshes])
 
 	# Print thread pool stats
 	if thread_pool:
@@ -1449,11 +1810,36 @@ func print_stats() -> void:
 		print("  Cache hit rate: %.1f%%" % cache_stats.hit_rate)
 		print("  Cache size: %.2f MB" % cache_stats.cache_size_mb)
 
+	# Print height tile cache stats
+	if terrain_generator:
+		var height_stats: Dictionary = terrain_generator.height_cache.get_stats()
+		print("  Height tiles: %d (%.1f%% hit rate, %d evicted)" % [
+			height_stats.tiles, height_stats.hit_rate, height_stats.evictions])
+
 	# Print region stats if batching enabled
 	if enable_region_batching:
 		print("  Region batching: Enabled")
 		print("  Active regions: %d" % active_regions.size())
-		print("  Dirty regions: %d" % dirty_regions.size())
+		print("  Pending chunk uploads: %d" % pending_chunk_uploads.size())
+
+	# Print LOD stats
+	if lod_manager:
+		var lod_stats := lod_manager.get_stats()
+		print("  LOD tiles: %d (%d with geometry, %d pending, %d retired)" % [
+			lod_stats.tiles, lod_stats.mesh_tiles, lod_stats.pending_tiles, lod_stats.retired_tiles])
+		print("  LOD vertices: %d" % lod_stats.vertices)
+
+	# Print far terrain stats
+	if far_terrain:
+		var far_stats := far_terrain.get_stats()
+		print("  Far terrain: %d rings, %d block reach (%d samples in %d slides)" % [
+			far_stats.rings, far_stats.reach, far_stats.samples, far_stats.slides])
+
+	# Print lighting stats
+	if light_engine:
+		var light_stats := light_engine.get_stats()
+		print("  Lighting: %d chunks stitched, %d edits, %d propagation steps" % [
+			light_stats.chunks_stitched, light_stats.edits, light_stats.steps])
 
 ## Get or create a region for the given chunk position
 func _get_or_create_region(chunk_pos: Vector3i) -> ChunkRegion:
@@ -1466,240 +1852,125 @@ func _get_or_create_region(chunk_pos: Vector3i) -> ChunkRegion:
 	# Create new region
 	var region := ChunkRegion.new(region_pos)
 	region.material = mesh_builder.default_material if mesh_builder else null
+	region.translucent_material = mesh_builder.translucent_material if mesh_builder else null
 	region.position = region.get_region_world_position()
 	add_child(region)
 
 	active_regions[region_pos] = region
 	regions_array.append(region)  # Add to array for consistent iteration
+	region.cull_slot = _add_cull_slot(region, region.get_aabb())
 
 	print("[ChunkManager] Created region at %s" % region_pos)
 	return region
 
-## Add chunk to its region
+## Mesh a chunk on the main thread into region-local arrays waiting for upload
+func _build_region_arrays_sync(chunk: Chunk) -> void:
+	var snapshot := ChunkSnapshot.capture(chunk, ChunkRegion.get_chunk_mesh_offset(chunk.position))
+	chunk.meshed_neighbor_mask = chunk.neighbor_mask
+	var mesh_data: Dictionary = mesh_builder.build_mesh_data(snapshot)
+	_store_quad_cache(chunk, mesh_data)
+	chunk.cached_mesh_arrays = mesh_data.get("arrays", [])
+	chunk.cached_translucent_arrays = mesh_data.get("translucent_arrays", [])
+
+## Keep the quads of an applied mesh as the base of the chunk's next partial remesh
+## Every change since the snapshot was captured queued a newer job (superseding this one)
+## or a full rebuild, so the chunk's dirty slices are all covered by this mesh
+func _store_quad_cache(chunk: Chunk, mesh_data: Dictionary) -> void:
+	chunk.quad_cache = mesh_data.get("quad_cache")
+	chunk.dirty_slices = PackedInt64Array()
+	if mesh_data.get("partial", false):
+		stats_partial_remeshes += 1
+	elif chunk.quad_cache:
+		chunk.needs_full_mesh = false
+
+## Get the region holding a chunk (null if the chunk isn't in a region)
+func _get_chunk_region(chunk_pos: Vector3i) -> ChunkRegion:
+	var region: ChunkRegion = active_regions.get(ChunkRegion.chunk_to_region_position(chunk_pos))
+	if region and region.has_chunk(chunk_pos):
+		return region
+	return null
+
+## Add chunk to its region and queue its mesh (chunk.cached_mesh_arrays) for upload
 func _add_chunk_to_region(chunk: Chunk) -> void:
 	if not enable_region_batching:
 		return
 
 	var region := _get_or_create_region(chunk.position)
-	region.add_chunk(chunk)
+	if not region.has_chunk(chunk.position):
+		region.add_chunk(chunk)
+		frustum_culler.update(region.cull_slot, region.get_aabb())
 
-	# Mark region as dirty
-	dirty_regions[region.region_position] = true
+	pending_chunk_uploads[chunk.position] = true
 
-## Remove chunk from its region
+## Remove chunk from its region (releases its mesh slot)
 func _remove_chunk_from_region(chunk_pos: Vector3i) -> void:
 	if not enable_region_batching:
 		return
 
+	pending_chunk_uploads.erase(chunk_pos)
 	var region_pos := ChunkRegion.chunk_to_region_position(chunk_pos)
 
 	if region_pos in active_regions:
 		var region: ChunkRegion = active_regions[region_pos]
 		region.remove_chunk(chunk_pos)
 
-		# Mark region as dirty
-		dirty_regions[region_pos] = true
+		if region.chunk_count > 0:
+			frustum_culler.update(region.cull_slot, region.get_aabb())
 
 		# If region is now empty, remove it
 		if region.chunk_count == 0:
+			_remove_cull_slot(region.cull_slot)
+			region.cull_slot = -1
 			active_regions.erase(region_pos)
 			regions_array.erase(region)  # Remove from array too
-			dirty_regions.erase(region_pos)
 			remove_child(region)
 			region.cleanup()
 			print("[ChunkManager] Removed empty region at %s" % region_pos)
 
-## Process dirty regions (rebuild their combined meshes)
-func _process_dirty_regions() -> void:
-	if dirty_regions.is_empty():
-		return
-
-	# Don't queue more jobs if thread pool is backed up
-	if thread_pool and thread_pool.get_pending_job_count() > MAX_PENDING_JOBS:
-		return
-
-	var regions_queued := 0
-
-	# Queue dirty regions for async rebuilding (limit per frame to avoid overwhelming thread pool)
-	for region_pos in dirty_regions.keys():
-		# Stop if we've hit our limit
-		if regions_queued >= max_region_rebuilds_per_frame:
-			break
-
-		# Skip if already being rebuilt
-		if region_pos in rebuilding_regions:
-			continue
-
-		# Check if region still exists
-		if not region_pos in active_regions:
-			dirty_regions.erase(region_pos)
-			continue
-
-		var region: ChunkRegion = active_regions[region_pos]
-		if not region or not is_instance_valid(region):
-			dirty_regions.erase(region_pos)
-			continue
-
-		# Skip if region doesn't need rebuild
-		if not region.needs_rebuild():
-			dirty_regions.erase(region_pos)
-			continue
-
-		# Queue region rebuild on worker thread
-		if thread_pool and mesh_builder:
-			# Calculate priority based on distance to player
-			var region_world_pos := region.get_region_world_position()
-			var distance := tracked_position.distance_to(region_world_pos)
-			var priority: float = 1.0 / max(distance, 1.0)
-
-			# Queue the job
-			thread_pool.queue_region_rebuild_job(region, region_pos, mesh_builder, priority)
-
-			# Mark as rebuilding
-			rebuilding_regions[region_pos] = true
-			regions_queued += 1
-
-	# Log queue status if we have a backlog
-	if dirty_regions.size() > 5 and regions_queued > 0:
-		print("[ChunkManager] Queued %d regions for async rebuild, %d regions pending, %d rebuilding" % [
-			regions_queued, dirty_regions.size(), rebuilding_regions.size()
-		])
-
-## Process pending mesh creations (deferred to prevent main thread stalls)
-## Creates at most 1 mesh per frame to maintain 60 FPS
-func _process_pending_mesh_creations() -> void:
-	if pending_mesh_creations.is_empty():
+## Upload meshed chunks into their region slots
+## Each upload writes only that chunk's vertices into the region buffer, so the per-frame
+## budget is in vertices; at least one chunk is uploaded per frame so large chunks can't stall
+func _process_pending_chunk_uploads() -> void:
+	if pending_chunk_uploads.is_empty():
 		return
 
-	# Sort pending meshes by vertex count (smallest first) for faster initial loading
-	# This ensures small meshes appear quickly while large ones are deferred
-	if pending_mesh_creations.size() > 1:
-		pending_mesh_creations.sort_custom(func(a, b): return a.vertex_count < b.vertex_count)
-
-	var meshes_created := 0
-	var vertices_processed := 0
 	var frame_start_time := Time.get_ticks_usec()
+	var vertices_uploaded := 0
+	var chunks_uploaded := 0
+	var bytes_uploaded := 0
 
-	# Process pending mesh creations (up to limits)
-	while not pending_mesh_creations.is_empty():
-		# Check if we've hit our per-frame limits
-		if meshes_created >= MAX_MESH_CREATIONS_PER_FRAME:
-			break
-		if vertices_processed >= MAX_VERTICES_PER_FRAME:
-			break
-
-		# Check time budget (bail out if we're taking too long)
-		var elapsed_ms := (Time.get_ticks_usec() - frame_start_time) / 1000.0
-		if elapsed_ms >= MAX_MESH_CREATION_TIME_MS:
-			break
+	for chunk_pos in pending_chunk_uploads.keys():
+		if chunks_uploaded > 0:
+			if vertices_uploaded >= MAX_VERTICES_PER_FRAME:
+				break
+			if (Time.get_ticks_usec() - frame_start_time) / 1000.0 >= MAX_UPLOAD_TIME_MS:
+				break
 
-		# Peek at next mesh to check if it's too large
-		var peek_data: Dictionary = pending_mesh_creations[0]
-		var peek_vertex_count: int = peek_data.vertex_count
-
-		# PERFORMANCE FIX: Absolutely skip meshes that are too large to prevent 2-3s stalls
-		# If a mesh has more than 2x our frame budget, skip it this frame
-		const ABSOLUTE_MAX_VERTICES: int = 6000  # Never create meshes larger than this in one frame
-		if peek_vertex_count > ABSOLUTE_MAX_VERTICES and meshes_created > 0:
-			# Move to end of queue - we'll try again next frame when we have full budget
-			pending_mesh_creations.pop_front()
-			pending_mesh_creations.append(peek_data)
-			break
+		pending_chunk_uploads.erase(chunk_pos)
 
-		# Skip meshes that would exceed our vertex budget
-		# Put them at the end of the queue to retry later
-		var mesh_data: Dictionary
-		if vertices_processed + peek_vertex_count > MAX_VERTICES_PER_FRAME:
-			# Move to end of queue and try next mesh
-			pending_mesh_creations.pop_front()
-			pending_mesh_creations.append(peek_data)
-
-			# If we've checked all meshes and none fit, break
-			if meshes_created == 0:
-				# All pending meshes are too large, process one anyway (but log a warning)
-				mesh_data = pending_mesh_creations.pop_front()
-				if peek_vertex_count > ABSOLUTE_MAX_VERTICES:
-					print("[ChunkManager] WARNING: Creating very large mesh with %d vertices - may cause stutter!" % peek_vertex_count)
-			else:
-				break
-		else:
-			# This mesh fits in our budget, process it
-			mesh_data = pending_mesh_creations.pop_front()
-
-		# Extract data from the mesh we're actually processing
-		var region_pos: Vector3i = mesh_data.region_pos
-		var region = mesh_data.region
-		var combined_arrays: Array = mesh_data.combined_arrays
-		var vertex_count: int = mesh_data.vertex_count
-		var chunk_count: int = mesh_data.chunk_count
-		var cache_hits: int = mesh_data.cache_hits
-		var cache_misses: int = mesh_data.cache_misses
-
-		# Validate region still exists
-		if not region or not is_instance_valid(region):
+		var chunk: Chunk = active_chunks.get_chunk(chunk_pos)
+		if not chunk or chunk.state != Chunk.State.ACTIVE:
 			continue
-		if not region_pos in active_regions:
+		var region := _get_chunk_region(chunk_pos)
+		if not region:
 			continue
 
-		# Measure time to create this mesh
-		var mesh_start_time := Time.get_ticks_usec()
-
-		# Create the mesh on the main thread (must be done here, not on worker thread)
-		# Clear existing mesh
-		if region.mesh_instance:
-			region.remove_child(region.mesh_instance)
-			region.mesh_instance.queue_free()
-			region.mesh_instance = null
-
-		# Create ArrayMesh with compression (Sodium-inspired optimization)
-		# Use Godot 4's ARRAY_FLAG_COMPRESS_ATTRIBUTES to compress normals, colors, uvs
-		var array_mesh := ArrayMesh.new()
-		var compression_flags: int = Mesh.ARRAY_FLAG_COMPRESS_ATTRIBUTES
-		array_mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, combined_arrays, [], {}, compression_flags)
-
-		# Create MeshInstance3D
-		region.mesh_instance = MeshInstance3D.new()
-		region.mesh_instance.mesh = array_mesh
-
-		# Apply material if available
-		if region.material:
-			region.mesh_instance.material_override = region.material
+		var arrays: Array = chunk.cached_mesh_arrays
+		var translucent_arrays: Array = chunk.cached_translucent_arrays
+		bytes_uploaded += region.upload_chunk(chunk_pos, arrays, translucent_arrays)
+		if not translucent_arrays.is_empty() and not region.is_translucent_slot_ordered(chunk_pos):
+			_translucent_unsorted_regions[region.region_position] = true
 
-		# Position at region origin
-		region.mesh_instance.position = Vector3.ZERO  # Vertices are already offset
+		# The region buffers keep their own copy - drop the CPU arrays
+		chunk.cached_mesh_arrays = []
+		chunk.cached_translucent_arrays = []
 
-		# Add to scene
-		region.add_child(region.mesh_instance)
+		if not arrays.is_empty():
+			vertices_uploaded += arrays[Mesh.ARRAY_VERTEX].size()
+		if not translucent_arrays.is_empty():
+			vertices_uploaded += translucent_arrays[Mesh.ARRAY_VERTEX].size()
+		chunks_uploaded += 1
 
-		# Update region stats
-		region.vertex_count = vertex_count
-		region.chunk_count = chunk_count
-
-		# Track progress
-		meshes_created += 1
-		vertices_processed += vertex_count
-
-		# Calculate mesh creation time
-		var mesh_creation_ms := (Time.get_ticks_usec() - mesh_start_time) / 1000.0
-
-		# Log performance stats
-		var cache_hit_rate := (cache_hits * 100.0 / chunk_count) if chunk_count > 0 else 0.0
-
-		# Only log if there were cache misses (indicates first-time builds) or if mesh is large
-		if cache_misses > 0 or chunk_count > 15 or vertex_count > 5000:
-			print("[ChunkRegion] Region %s: %d chunks (%d vertices), cache: %d hits/%d misses (%.0f%% hit rate), %.1fms [DEFERRED]" % [
-				region_pos, chunk_count, vertex_count,
-				cache_hits, cache_misses, cache_hit_rate, mesh_creation_ms
-			])
-
-	# Log queue status if we have pending meshes
-	if pending_mesh_creations.size() > 0:
-		var total_pending_vertices := 0
-		for pending_mesh in pending_mesh_creations:
-			total_pending_vertices += pending_mesh.vertex_count
-
-		print("[ChunkManager] Created %d meshes (%d vertices in %.1fms), %d meshes pending (%d vertices)" % [
-			meshes_created, vertices_processed,
-			(Time.get_ticks_usec() - frame_start_time) / 1000.0,
-			pending_mesh_creations.size(), total_pending_vertices
-		])
+	stats_bytes_uploaded += bytes_uploaded
+	if pending_chunk_uploads.is_empty():
+		_check_initial_chunks_ready()
@@ -1,33 +1,50 @@
 ## ChunkMeshBuilder - Generates optimized meshes for chunks
-## Uses greedy meshing with vertex compression (Sodium-inspired optimizations)
-## Properly handles cross-chunk face culling using neighbor references
+## Uses bitmask greedy meshing (BinaryGreedyMesher) with a packed 8-byte vertex format
+## (Sodium-inspired) decoded by shaders/voxel_chunk.gdshader
+## Opaque and translucent (liquid, glass, leaves) quads are built as two separate surfaces
+## Properly handles cross-chunk face culling via a padded voxel buffer holding neighbor borders
+## Meshing reads only ChunkSnapshot data, never live chunks, so it is safe on worker threads
 class_name ChunkMeshBuilder
 extends RefCounted
 
 ## Voxel size in world units (1.0 = 1 meter cube)
+## Packed vertices store whole voxels, so meshes are built at this scale
 const VOXEL_SIZE: float = 1.0
 
-## Enable vertex compression (Sodium-inspired: reduces memory by ~30-40%)
-## Uses half-precision floats and compressed formats to reduce bandwidth
-## NOTE: Godot 4 handles compression differently - using ArrayFormat flags
-const ENABLE_VERTEX_COMPRESSION: bool = true
-
-## Godot 4 compression flags (ArrayFormat enum)
-## ARRAY_FLAG_COMPRESS_ATTRIBUTES compresses normals, tangents, colors, uvs
-const COMPRESSION_FLAGS: int = Mesh.ARRAY_FLAG_COMPRESS_ATTRIBUTES if ENABLE_VERTEX_COMPRESSION else 0
-
-## Face direction vectors
-const FACE_NORMALS := {
-	"top": Vector3.UP,
-	"bottom": Vector3.DOWN,
-	"north": Vector3.FORWARD,
-	"south": Vector3.BACK,
-	"east": Vector3.RIGHT,
-	"west": Vector3.LEFT
-}
-
-## Default material (will be replaced with textured material in Phase 2)
-var default_material: StandardMaterial3D
+## Packed vertex format: two 24-bit integer words per vertex, stored as the float32 x/y
+## of a 2D vertex (integers below 2^24 are exact in float32), with no other attributes
+##   word0: x (8) | z (8) << 8 | face (3) << 16 | ao (2) << 19
+##   word1: y (10) | block type (8) << 10 | light (4) << 18
+## Light is the face's baked level (LightEngine), constant over a quad
+## Positions are integer voxel corners relative to the mesh origin (x/z up to a region's
+## 128 blocks, y up to a region's 8 chunk levels). 8 bytes per vertex vs ~48 for
+## float position + normal + color + UV
+const SURFACE_FORMAT_FLAGS: int = Mesh.ARRAY_FLAG_USE_2D_VERTICES
+const PACK_Z_SHIFT: int = 8
+const PACK_FACE_SHIFT: int = 16
+const PACK_AO_SHIFT: int = 19
+const PACK_TYPE_SHIFT: int = 10
+const PACK_LIGHT_SHIFT: int = 18
+
+## Shaders decoding the packed format (opaque and alpha-blended translucent pass)
+const CHUNK_SHADER: Shader = preload("res://scripts/voxel_engine_v2/shaders/voxel_chunk.gdshader")
+const TRANSLUCENT_SHADER: Shader = preload("res://scripts/voxel_engine_v2/shaders/voxel_chunk_translucent.gdshader")
+
+## Face shading per BinaryGreedyMesher.Face (simple directional lighting)
+const FACE_SHADES: PackedFloat32Array = [
+	0.75,  # +X (east)
+	0.75,  # -X (west)
+	1.0,   # +Y (top, facing sky)
+	0.6,   # -Y (bottom, shadow)
+	0.85,  # +Z (north)
+	0.85   # -Z (south)
+]
+
+## Default material (packed-vertex shader, will get textures in Phase 2)
+var default_material: ShaderMaterial
+
+## Material of the translucent surface (same uniforms, alpha-blended)
+var translucent_material: ShaderMaterial
 
 ## Reference to chunk manager (for neighbor queries)
 var chunk_manager: ChunkManager
@@ -36,13 +53,23 @@ func _init(manager: ChunkManager = null) -> void:
 	chunk_manager = manager
 	_create_default_material()
 
-## Create a simple default material for testing
+## Create the chunk materials: block colors and face shades are shader uniforms,
+## the vertices only carry the block type and face
 func _create_default_material() -> void:
-	default_material = StandardMaterial3D.new()
-	default_material.albedo_color = Color(1.0, 1.0, 1.0)  # White base for vertex colors
-	default_material.vertex_color_use_as_albedo = true  # CRITICAL: Use vertex colors!
-	default_material.roughness = 1.0
-	default_material.cull_mode = BaseMaterial3D.CULL_BACK
+	var block_colors := PackedColorArray()
+	block_colors.resize(256)
+	for voxel_type in range(256):
+		block_colors[voxel_type] = _get_color_for_voxel_type(voxel_type)
+
+	default_material = ShaderMaterial.new()
+	default_material.shader = CHUNK_SHADER
+	default_material.set_shader_parameter("block_colors", block_colors)
+	default_material.set_shader_parameter("face_shades", FACE_SHADES)
+
+	translucent_material = ShaderMaterial.new()
+	translucent_material.shader = TRANSLUCENT_SHADER
+	translucent_material.set_shader_parameter("block_colors", block_colors)
+	translucent_material.set_shader_parameter("face_shades", FACE_SHADES)
 
 ## Build mesh for a chunk using greedy meshing
 func build_mesh(chunk: Chunk) -> MeshInstance3D:
@@ -54,401 +81,149 @@ func build_mesh(chunk: Chunk) -> MeshInstance3D:
 	if chunk.is_empty():
 		return null
 
-	# Reduce console spam - only print occasionally
-	# print("[MeshBuilder] Building greedy mesh for chunk %s..." % chunk.position)
-
-	# Create surface tool for mesh building
-	var st := SurfaceTool.new()
-	st.begin(Mesh.PRIMITIVE_TRIANGLES)
-
-	var vertices_added := 0
-	var quads_added := 0
-
-	# Process each axis direction for greedy meshing
-	# Each direction processes slices perpendicular to that axis
-	var directions := [
-		{"axis": Vector3i.UP, "name": "up"},
-		{"axis": Vector3i.DOWN, "name": "down"},
-		{"axis": Vector3i.FORWARD, "name": "forward"},
-		{"axis": Vector3i.BACK, "name": "back"},
-		{"axis": Vector3i.RIGHT, "name": "right"},
-		{"axis": Vector3i.LEFT, "name": "left"}
-	]
-
-	for dir_info in directions:
-		var result := _greedy_mesh_direction(st, chunk, dir_info.axis)
-		vertices_added += result.vertices
-		quads_added += result.quads
-
-	# Check if we have any geometry
-	if vertices_added == 0:
-		return null
-
-	# Index the mesh for optimization
-	st.index()
-
-	# Create mesh instance with compression
-	var mesh_instance := MeshInstance3D.new()
-	# Commit with vertex compression flags (Sodium-inspired optimization)
-	# This reduces memory bandwidth by ~30-40%
-	mesh_instance.mesh = st.commit(null, COMPRESSION_FLAGS)
-	mesh_instance.material_override = default_material
-
-	# Enable shadow casting
-	mesh_instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_ON
-
-	# Reduce console spam
-	# print("[MeshBuilder] ✓ Greedy mesh created successfully")
-	return mesh_instance
-
-## Build mesh data for a chunk (thread-safe version)
-## Returns mesh data as a Dictionary that can be converted to MeshInstance3D on main thread
-func build_mesh_data(chunk: Chunk) -> Dictionary:
-	if not chunk or not chunk.voxel_data:
-		return {}
-
-	# Skip empty chunks
-	if chunk.is_empty():
+	return create_mesh_instance_from_data(build_mesh_data(ChunkSnapshot.capture(chunk)))
+
+## Build mesh data from a snapshot (thread-safe version)
+## Returns mesh arrays as a Dictionary; the ArrayMesh is created on the main thread
+## in create_mesh_instance_from_data (region batching only needs the arrays)
+## Always includes the chunk's face "connectivity" (for occlusion culling), even when
+## the chunk produced no geometry - "arrays" and "translucent_arrays" are only present if
+## there are quads, and then both are (either may be an empty Array)
+## The translucent pass runs after the opaque one over the same padded buffer
+## "quad_cache" holds the quads by (face, slice) for later partial remeshes; a snapshot
+## carrying a quad cache only re-meshes its dirty slices and splices them in ("partial")
+func build_mesh_data(snapshot: ChunkSnapshot) -> Dictionary:
+	if not snapshot or snapshot.is_empty():
 		return {}
 
-	# Create surface tool for mesh building
-	var st := SurfaceTool.new()
-	st.begin(Mesh.PRIMITIVE_TRIANGLES)
-
-	var vertices_added := 0
-	var quads_added := 0
-
-	# Process each axis direction for greedy meshing
-	var directions := [
-		{"axis": Vector3i.UP, "name": "up"},
-		{"axis": Vector3i.DOWN, "name": "down"},
-		{"axis": Vector3i.FORWARD, "name": "forward"},
-		{"axis": Vector3i.BACK, "name": "back"},
-		{"axis": Vector3i.RIGHT, "name": "right"},
-		{"axis": Vector3i.LEFT, "name": "left"}
-	]
-
-	for dir_info in directions:
-		var result := _greedy_mesh_direction(st, chunk, dir_info.axis)
-		vertices_added += result.vertices
-		quads_added += result.quads
-
-	# Check if we have any geometry
-	if vertices_added == 0:
+	var padded := snapshot.build_padded()
+	var light := snapshot.build_padded_light()
+	var cache: ChunkQuadCache
+	if snapshot.quad_cache:
+		cache = snapshot.quad_cache
+		cache.splice(ChunkQuadCache.from_quads(
+			BinaryGreedyMesher.mesh(padded, snapshot.size_y, light, snapshot.slice_masks),
+			BinaryGreedyMesher.mesh_translucent(padded, snapshot.size_y, light, snapshot.slice_masks)),
+			snapshot.slice_masks)
+	else:
+		cache = ChunkQuadCache.from_quads(BinaryGreedyMesher.mesh(padded, snapshot.size_y, light),
+										  BinaryGreedyMesher.mesh_translucent(padded, snapshot.size_y, light))
+
+	var mesh_data := build_quads_mesh_data(cache.get_opaque_quads(), cache.get_translucent_quads(),
+										   snapshot.size_y, snapshot.mesh_offset)
+	mesh_data["connectivity"] = BinaryGreedyMesher.compute_connectivity(padded, snapshot.size_y)
+	mesh_data["quad_cache"] = cache
+	mesh_data["partial"] = snapshot.quad_cache != null
+	return mesh_data
+
+## Mesh any padded 16 x size_y x 16 buffer (chunk snapshots, LOD tiles), thread-safe
+## light is the matching padded light buffer (empty = full light, e.g. for LOD tiles)
+## Returns an empty Dictionary if the buffer produced no quads
+func build_padded_mesh_data(padded: PackedByteArray, size_y: int, offset: Vector3 = Vector3.ZERO,
+							light: PackedByteArray = PackedByteArray()) -> Dictionary:
+	return build_quads_mesh_data(BinaryGreedyMesher.mesh(padded, size_y, light),
+								 BinaryGreedyMesher.mesh_translucent(padded, size_y, light), size_y, offset)
+
+## Build the packed surface arrays of meshed quads, thread-safe
+## Returns an empty Dictionary if there are no quads
+func build_quads_mesh_data(quads: PackedInt64Array, translucent_quads: PackedInt64Array, size_y: int,
+						   offset: Vector3 = Vector3.ZERO) -> Dictionary:
+	if quads.is_empty() and translucent_quads.is_empty():
 		return {}
 
-	# Index the mesh for optimization
-	st.index()
-
-	# Commit to mesh and return data (with compression if enabled)
-	var mesh: ArrayMesh = st.commit(null, COMPRESSION_FLAGS)
-
-	# Also extract arrays for region batching
-	var arrays := mesh.surface_get_arrays(0) if mesh.get_surface_count() > 0 else []
+	var arrays := _quads_to_arrays(quads, offset) if not quads.is_empty() else []
+	var translucent_arrays := _quads_to_arrays(translucent_quads, offset) if not translucent_quads.is_empty() else []
 
 	return {
-		"mesh": mesh,
 		"arrays": arrays,
-		"vertices": vertices_added,
-		"quads": quads_added
+		"translucent_arrays": translucent_arrays,
+		"vertices": (quads.size() + translucent_quads.size()) * 4,
+		"quads": quads.size(),
+		"translucent_quads": translucent_quads.size(),
+		"bounds": _get_chunk_bounds(size_y)
 	}
 
-## Build mesh arrays for region batching (returns raw arrays, not committed mesh)
-## This is used by ChunkRegion to combine multiple chunks into one mesh
-func build_mesh_arrays(chunk: Chunk) -> Array:
-	if not chunk or not chunk.voxel_data:
-		return []
-
-	# Skip empty chunks
-	if chunk.is_empty():
-		return []
-
-	# Create surface tool for mesh building
-	var st := SurfaceTool.new()
-	st.begin(Mesh.PRIMITIVE_TRIANGLES)
-
-	# Process each axis direction for greedy meshing
-	var directions := [
-		{"axis": Vector3i.UP, "name": "up"},
-		{"axis": Vector3i.DOWN, "name": "down"},
-		{"axis": Vector3i.FORWARD, "name": "forward"},
-		{"axis": Vector3i.BACK, "name": "back"},
-		{"axis": Vector3i.RIGHT, "name": "right"},
-		{"axis": Vector3i.LEFT, "name": "left"}
-	]
-
-	var vertices_added := 0
-	for dir_info in directions:
-		var result := _greedy_mesh_direction(st, chunk, dir_info.axis)
-		vertices_added += result.vertices
-
-	# Check if we have any geometry
-	if vertices_added == 0:
-		return []
-
-	# Index the mesh for optimization
-	st.index()
-
-	# Commit to temporary mesh to get arrays (with compression if enabled)
-	var temp_mesh: ArrayMesh = st.commit(null, COMPRESSION_FLAGS)
-
-	# Extract arrays
-	if temp_mesh.get_surface_count() > 0:
-		return temp_mesh.surface_get_arrays(0)
-
-	return []
-
 ## Create MeshInstance3D from mesh data (call on main thread)
 func create_mesh_instance_from_data(mesh_data: Dictionary) -> MeshInstance3D:
-	if mesh_data.is_empty() or not mesh_data.has("mesh"):
+	if mesh_data.is_empty() or not mesh_data.has("arrays"):
 		return null
 
 	var mesh_instance := MeshInstance3D.new()
-	mesh_instance.mesh = mesh_data.mesh
-	mesh_instance.material_override = default_material
+	mesh_instance.mesh = _create_array_mesh(mesh_data.arrays, mesh_data.translucent_arrays, mesh_data.bounds)
 	mesh_instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_ON
 
 	return mesh_instance
 
-## Add visible faces for a single voxel
-## Returns the number of vertices added (6 per face)
-func _add_voxel_faces(st: SurfaceTool, chunk: Chunk, local_pos: Vector3i, voxel_type: int) -> int:
-	var world_pos := local_pos * VOXEL_SIZE
-	var vertices_added := 0
-
-	# Check each face direction (each face adds 6 vertices)
-	if _should_add_face(chunk, local_pos, Vector3i.UP):
-		_add_top_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	if _should_add_face(chunk, local_pos, Vector3i.DOWN):
-		_add_bottom_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	if _should_add_face(chunk, local_pos, Vector3i.FORWARD):
-		# FORWARD is -Z direction, so render the -Z face (south)
-		_add_south_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	if _should_add_face(chunk, local_pos, Vector3i.BACK):
-		# BACK is +Z direction, so render the +Z face (north)
-		_add_north_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	if _should_add_face(chunk, local_pos, Vector3i.RIGHT):
-		_add_east_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	if _should_add_face(chunk, local_pos, Vector3i.LEFT):
-		_add_west_face(st, world_pos, voxel_type)
-		vertices_added += 6
-
-	return vertices_added
-
-## Determine if a face should be added (face culling logic)
-## Checks both within chunk and across chunk boundaries
-func _should_add_face(chunk: Chunk, local_pos: Vector3i, direction: Vector3i) -> bool:
-	var neighbor_pos := local_pos + direction
-
-	# Check if neighbor is within current chunk
-	if chunk.voxel_data.is_position_valid(neighbor_pos):
-		var neighbor_voxel := chunk.get_voxel(neighbor_pos)
-		# Add face if neighbor is air or transparent
-		return neighbor_voxel == VoxelTypes.Type.AIR or VoxelTypes.is_transparent(neighbor_voxel)
-
-	# Neighbor is outside chunk, need to check neighboring chunk
-	var neighbor_chunk := _get_neighbor_chunk(chunk, direction)
-
-	if neighbor_chunk:
-		# Convert position to neighbor chunk's local space
-		var world_pos := chunk.local_to_world(neighbor_pos)
-		var neighbor_local := neighbor_chunk.world_to_local(world_pos)
-
-		if neighbor_chunk.voxel_data.is_position_valid(neighbor_local):
-			var neighbor_voxel := neighbor_chunk.get_voxel(neighbor_local)
-			# Add face if neighbor is air or transparent
-			return neighbor_voxel == VoxelTypes.Type.AIR or VoxelTypes.is_transparent(neighbor_voxel)
-
-	# If neighbor chunk doesn't exist, assume it's solid (don't render the face)
-	# This prevents visible chunk boundary walls when underground
-	return false
-
-## Get neighboring chunk based on direction
-func _get_neighbor_chunk(chunk: Chunk, direction: Vector3i) -> Chunk:
-	if direction == Vector3i.UP:
-		return chunk.get_neighbor("up")
-	elif direction == Vector3i.DOWN:
-		return chunk.get_neighbor("down")
-	elif direction == Vector3i.FORWARD:
-		# FORWARD is (0,0,-1) which is negative Z, maps to "south"
-		return chunk.get_neighbor("south")
-	elif direction == Vector3i.BACK:
-		# BACK is (0,0,1) which is positive Z, maps to "north"
-		return chunk.get_neighbor("north")
-	elif direction == Vector3i.RIGHT:
-		return chunk.get_neighbor("east")
-	elif direction == Vector3i.LEFT:
-		return chunk.get_neighbor("west")
-	return null
-
-## Greedy mesh a single direction
-## Returns dictionary with vertex and quad counts
-func _greedy_mesh_direction(st: SurfaceTool, chunk: Chunk, direction: Vector3i) -> Dictionary:
-	var vertices_added := 0
-	var quads_added := 0
-
-	# Determine the axis we're looking along and the two perpendicular axes
-	var axis_index := _get_primary_axis_index(direction)
-	var axes := _get_axis_permutation(axis_index)
-
-	# u and v are the two axes perpendicular to the direction we're looking
-	var u_axis: int = axes[0]
-	var v_axis: int = axes[1]
-	var d_axis: int = axes[2]  # The direction axis
-
-	# Get chunk dimensions (handle adaptive Y sizing)
-	var chunk_size_x := VoxelData.CHUNK_SIZE_XZ
-	var chunk_size_y := chunk.voxel_data.chunk_size_y
-	var chunk_size_z := VoxelData.CHUNK_SIZE_XZ
-
-	var dimensions := [chunk_size_x, chunk_size_y, chunk_size_z]
-	var u_size: int = dimensions[u_axis]
-	var v_size: int = dimensions[v_axis]
-	var d_size: int = dimensions[d_axis]
-
-	# THREAD-SAFE: Allocate mask locally for this direction (reused across slices)
-	# Cannot be a member variable since multiple threads call this simultaneously
-	var mask: Array = []
-	mask.resize(u_size)
-	for i in range(u_size):
-		mask[i] = []
-		mask[i].resize(v_size)
-
-	# Iterate through each slice perpendicular to the direction
-	for d in range(d_size):
-		# Clear mask for this slice
-		for i in range(u_size):
-			for j in range(v_size):
-				mask[i][j] = null
-
-		# Fill the mask and track if slice has any faces
-		var has_faces := false
-		for u in range(u_size):
-			for v in range(v_size):
-				# Build position in 3D space
-				var pos := Vector3i.ZERO
-				pos[u_axis] = u
-				pos[v_axis] = v
-				pos[d_axis] = d
-
-				# Check if this voxel needs a face in this direction
-				var voxel_type := chunk.get_voxel(pos)
-				if voxel_type != VoxelTypes.Type.AIR and not VoxelTypes.is_transparent(voxel_type):
-					if _should_add_face(chunk, pos, direction):
-						mask[u][v] = voxel_type
-						has_faces = true
-
-		# Skip empty slices (major performance optimization!)
-		if not has_faces:
-			continue
-
-		# Greedily merge quads in this slice
-		var result := _merge_quads_in_mask(st, chunk, mask, direction, u_axis, v_axis, d_axis, d, u_size, v_size)
-		vertices_added += result.vertices
-		quads_added += result.quads
-
-	return {"vertices": vertices_added, "quads": quads_added}
-
-## Get the primary axis index from a direction vector
-func _get_primary_axis_index(direction: Vector3i) -> int:
-	if direction.x != 0:
-		return 0  # X axis
-	elif direction.y != 0:
-		return 1  # Y axis
-	else:
-		return 2  # Z axis
-
-## Get axis permutation for greedy meshing
-## Returns [u_axis, v_axis, d_axis] where u and v are perpendicular to d
-func _get_axis_permutation(primary_axis: int) -> Array:
-	match primary_axis:
-		0:  # X is primary (east/west faces)
-			return [1, 2, 0]  # u=Y, v=Z, d=X
-		1:  # Y is primary (up/down faces)
-			return [0, 2, 1]  # u=X, v=Z, d=Y
-		2:  # Z is primary (north/south faces)
-			return [0, 1, 2]  # u=X, v=Y, d=Z
-		_:
-			return [0, 1, 2]
-
-## Greedily merge quads in a 2D mask
-func _merge_quads_in_mask(st: SurfaceTool, chunk: Chunk, mask: Array, direction: Vector3i,
-						  u_axis: int, v_axis: int, d_axis: int, d: int, u_size: int, v_size: int) -> Dictionary:
-	var vertices_added := 0
-	var quads_added := 0
-
-	# Greedy meshing algorithm
-	for u in range(u_size):
-		for v in range(v_size):
-			# Skip empty mask cells
-			var mask_value = mask[u][v]
-			if mask_value == null:
-				continue
-
-			var voxel_type: int = mask_value
-
-			# Measure width (in v direction)
-			var width := 1
-			while v + width < v_size and mask[u][v + width] == voxel_type:
-				width += 1
-
-			# Measure height (in u direction)
-			var height := 1
-			var done := false
-			while u + height < u_size and not done:
-				# Check if we can extend the rectangle
-				for k in range(width):
-					if mask[u + height][v + k] != voxel_type:
-						done = true
-						break
-				if not done:
-					height += 1
-
-			# Create the merged quad
-			var pos := Vector3i.ZERO
-			pos[u_axis] = u
-			pos[v_axis] = v
-			pos[d_axis] = d
-
-			_add_greedy_quad(st, pos, direction, width, height, u_axis, v_axis, voxel_type)
-			vertices_added += 6
-			quads_added += 1
-
-			# Clear the mask for merged area
-			for du in range(height):
-				for dv in range(width):
-					mask[u + du][v + dv] = null
-
-	return {"vertices": vertices_added, "quads": quads_added}
-
-## Add a quad with custom width and height for greedy meshing
-func _add_greedy_quad(st: SurfaceTool, pos: Vector3i, direction: Vector3i, width: int, height: int,
-					  u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var world_pos := Vector3(pos) * VOXEL_SIZE
-
-	# Determine which face to add based on direction
-	if direction == Vector3i.UP:
-		_add_top_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
-	elif direction == Vector3i.DOWN:
-		_add_bottom_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
-	elif direction == Vector3i.FORWARD:
-		_add_south_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
-	elif direction == Vector3i.BACK:
-		_add_north_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
-	elif direction == Vector3i.RIGHT:
-		_add_east_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
-	elif direction == Vector3i.LEFT:
-		_add_west_face_sized(st, world_pos, width, height, u_axis, v_axis, voxel_type)
+## Create an ArrayMesh from packed surface arrays: the opaque surface first, then the
+## translucent one, each with its own material (either may be empty and is then skipped)
+## Packed positions aren't real coordinates, so the bounds are set explicitly
+func _create_array_mesh(arrays: Array, translucent_arrays: Array, bounds: AABB) -> ArrayMesh:
+	var mesh := ArrayMesh.new()
+	if not arrays.is_empty():
+		mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, arrays, [], {}, SURFACE_FORMAT_FLAGS)
+		mesh.surface_set_material(mesh.get_surface_count() - 1, default_material)
+	if not translucent_arrays.is_empty():
+		mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, translucent_arrays, [], {}, SURFACE_FORMAT_FLAGS)
+		mesh.surface_set_material(mesh.get_surface_count() - 1, translucent_material)
+	mesh.custom_aabb = bounds
+	return mesh
+
+## Local bounds of a chunk mesh
+func _get_chunk_bounds(size_y: int) -> AABB:
+	var size_xz := VoxelData.CHUNK_SIZE_XZ * VOXEL_SIZE
+	return AABB(Vector3.ZERO, Vector3(size_xz, size_y * VOXEL_SIZE, size_xz))
+
+## Convert packed quads into indexed surface arrays of packed vertices
+## Buffers are sized up front (4 vertices + 6 indices per quad) and written in place
+## Vertices stay quad-ordered (4 per quad), which RegionMeshBuffer slots rely on, so the
+## AO diagonal flip rotates the vertex order instead of changing the index pattern
+## offset must be a whole number of voxels (chunk origins always are)
+func _quads_to_arrays(quads: PackedInt64Array, offset: Vector3 = Vector3.ZERO) -> Array:
+	var quad_count := quads.size()
+	var origin := Vector3i(offset)
+
+	var vertices := PackedVector2Array()
+	var indices := PackedInt32Array()
+	vertices.resize(quad_count * 4)
+	indices.resize(quad_count * 6)
+
+	for q in range(quad_count):
+		var quad: int = quads[q]
+		var face := BinaryGreedyMesher.quad_face(quad)
+		var corners := BinaryGreedyMesher.quad_corners(quad)
+		var corner_ao := BinaryGreedyMesher.quad_corner_ao(quad)
+
+		# Split along the diagonal with the brighter corners, so AO interpolates evenly
+		# (triangles use diagonal 0-2 - starting at corner 1 makes it 1-3)
+		var first_corner := 1 if corner_ao[0] + corner_ao[2] < corner_ao[1] + corner_ao[3] else 0
+
+		# Per-quad parts of the two words
+		var word0_face := face << PACK_FACE_SHIFT
+		var word1_attributes := (BinaryGreedyMesher.quad_type(quad) << PACK_TYPE_SHIFT) | (BinaryGreedyMesher.quad_light(quad) << PACK_LIGHT_SHIFT)
+
+		var v := q * 4
+		for c in range(4):
+			var k := (first_corner + c) & 3
+			var corner := Vector3i(corners[k]) + origin
+			vertices[v + c] = Vector2(
+				corner.x | (corner.z << PACK_Z_SHIFT) | word0_face | (corner_ao[k] << PACK_AO_SHIFT),
+				corner.y | word1_attributes
+			)
+
+		# Two clockwise triangles (0, 1, 2) and (0, 2, 3)
+		var i := q * 6
+		indices[i] = v
+		indices[i + 1] = v + 1
+		indices[i + 2] = v + 2
+		indices[i + 3] = v
+		indices[i + 4] = v + 2
+		indices[i + 5] = v + 3
+
+	var arrays: Array = []
+	arrays.resize(Mesh.ARRAY_MAX)
+	arrays[Mesh.ARRAY_VERTEX] = vertices
+	arrays[Mesh.ARRAY_INDEX] = indices
+	return arrays
 
 ## Get color based on voxel type
 func _get_color_for_voxel_type(voxel_type: int) -> Color:
@@ -479,179 +254,7 @@ func _get_color_for_voxel_type(voxel_type: int) -> Color:
 			return Color(0.45, 0.45, 0.45)  # Medium gray
 		VoxelTypes.Type.LAVA:
 			return Color(1.0, 0.4, 0.1)  # Orange-red
+		VoxelTypes.Type.GLASS:
+			return Color(0.8, 0.9, 0.95, 0.3)  # Pale blue (mostly see-through)
 		_:
 			return Color(0.7, 0.7, 0.7)  # Default gray
-
-## Add a quad (two triangles) with color
-## Vertices should be in counter-clockwise order when viewed from outside
-func _add_quad(st: SurfaceTool, vertices: PackedVector3Array, normal: Vector3, color: Color) -> void:
-	# First triangle (0, 1, 2) - counter-clockwise
-	st.set_color(color)
-	st.set_normal(normal)
-	st.add_vertex(vertices[0])
-	st.set_normal(normal)
-	st.add_vertex(vertices[1])
-	st.set_normal(normal)
-	st.add_vertex(vertices[2])
-
-	# Second triangle (0, 2, 3) - counter-clockwise
-	st.set_color(color)
-	st.set_normal(normal)
-	st.add_vertex(vertices[0])
-	st.set_normal(normal)
-	st.add_vertex(vertices[2])
-	st.set_normal(normal)
-	st.add_vertex(vertices[3])
-
-## Top face (+Y) - looking down from above, vertices are counter-clockwise
-func _add_top_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, VOXEL_SIZE, 0),              # back-left
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, 0),      # back-right
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, VOXEL_SIZE), # front-right
-		pos + Vector3(0, VOXEL_SIZE, VOXEL_SIZE)       # front-left
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.UP, color * 1.0)  # Brightest (facing sky)
-
-## Bottom face (-Y) - looking up from below, vertices are counter-clockwise
-func _add_bottom_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, 0),              # back-left
-		pos + Vector3(0, 0, VOXEL_SIZE),      # front-left
-		pos + Vector3(VOXEL_SIZE, 0, VOXEL_SIZE), # front-right
-		pos + Vector3(VOXEL_SIZE, 0, 0)       # back-right
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.DOWN, color * 0.6)  # Darker (shadow)
-
-## North face (+Z) - looking from front, vertices are counter-clockwise
-func _add_north_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, VOXEL_SIZE),              # bottom-left
-		pos + Vector3(0, VOXEL_SIZE, VOXEL_SIZE),      # top-left
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, VOXEL_SIZE), # top-right
-		pos + Vector3(VOXEL_SIZE, 0, VOXEL_SIZE)       # bottom-right
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.FORWARD, color * 0.85)  # Slightly shaded
-
-## South face (-Z) - looking from back, vertices are counter-clockwise
-func _add_south_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(VOXEL_SIZE, 0, 0),      # bottom-right (when viewing from back)
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, 0), # top-right
-		pos + Vector3(0, VOXEL_SIZE, 0),      # top-left
-		pos + Vector3(0, 0, 0)                # bottom-left
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.BACK, color * 0.85)  # Slightly shaded
-
-## East face (+X) - looking from right side, vertices are counter-clockwise
-func _add_east_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(VOXEL_SIZE, 0, VOXEL_SIZE),  # bottom-front
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, VOXEL_SIZE), # top-front
-		pos + Vector3(VOXEL_SIZE, VOXEL_SIZE, 0),  # top-back
-		pos + Vector3(VOXEL_SIZE, 0, 0)            # bottom-back
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.RIGHT, color * 0.75)  # Medium shade
-
-## West face (-X) - looking from left side, vertices are counter-clockwise
-func _add_west_face(st: SurfaceTool, pos: Vector3, voxel_type: int) -> void:
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, 0),           # bottom-back
-		pos + Vector3(0, VOXEL_SIZE, 0),   # top-back
-		pos + Vector3(0, VOXEL_SIZE, VOXEL_SIZE), # top-front
-		pos + Vector3(0, 0, VOXEL_SIZE)    # bottom-front
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.LEFT, color * 0.75)  # Medium shade
-
-## Greedy meshing sized face functions
-## These create quads with custom width and height for merged faces
-
-## Top face (+Y) - sized version for greedy meshing
-func _add_top_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-						 u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, VOXEL_SIZE, 0),
-		pos + Vector3(h, VOXEL_SIZE, 0),
-		pos + Vector3(h, VOXEL_SIZE, w),
-		pos + Vector3(0, VOXEL_SIZE, w)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.UP, color * 1.0)
-
-## Bottom face (-Y) - sized version for greedy meshing
-func _add_bottom_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-							u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, 0),
-		pos + Vector3(0, 0, w),
-		pos + Vector3(h, 0, w),
-		pos + Vector3(h, 0, 0)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.DOWN, color * 0.6)
-
-## North face (+Z) - sized version for greedy meshing
-func _add_north_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-						   u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, VOXEL_SIZE),
-		pos + Vector3(0, w, VOXEL_SIZE),
-		pos + Vector3(h, w, VOXEL_SIZE),
-		pos + Vector3(h, 0, VOXEL_SIZE)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.FORWARD, color * 0.85)
-
-## South face (-Z) - sized version for greedy meshing
-func _add_south_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-						   u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(h, 0, 0),
-		pos + Vector3(h, w, 0),
-		pos + Vector3(0, w, 0),
-		pos + Vector3(0, 0, 0)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.BACK, color * 0.85)
-
-## East face (+X) - sized version for greedy meshing
-func _add_east_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-						  u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(VOXEL_SIZE, 0, w),
-		pos + Vector3(VOXEL_SIZE, h, w),
-		pos + Vector3(VOXEL_SIZE, h, 0),
-		pos + Vector3(VOXEL_SIZE, 0, 0)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.RIGHT, color * 0.75)
-
-## West face (-X) - sized version for greedy meshing
-func _add_west_face_sized(st: SurfaceTool, pos: Vector3, width: int, height: int,
-						  u_axis: int, v_axis: int, voxel_type: int) -> void:
-	var w := float(width) * VOXEL_SIZE
-	var h := float(height) * VOXEL_SIZE
-	var vertices := PackedVector3Array([
-		pos + Vector3(0, 0, 0),
-		pos + Vector3(0, h, 0),
-		pos + Vector3(0, h, w),
-		pos + Vector3(0, 0, w)
-	])
-	var color := _get_color_for_voxel_type(voxel_type)
-	_add_quad(st, vertices, Vector3.LEFT, color * 0.75)
@@ -1,5 +1,7 @@
 ## ChunkThreadPool - Manages worker threads for chunk generation and meshing
 ## Offloads CPU-intensive operations from the main thread to prevent stuttering
+## Scheduling: per-worker deques with work stealing, a max-heap lane for urgent jobs,
+## and semaphore wakeups so idle workers sleep instead of polling
 class_name ChunkThreadPool
 extends RefCounted
 
@@ -7,50 +9,82 @@ extends RefCounted
 enum JobType {
 	GENERATE_TERRAIN,  ## Generate terrain data for a chunk
 	BUILD_MESH,        ## Build mesh for a chunk
-	BUILD_REGION_MESH  ## Build combined mesh for a region (batched chunks)
+	BUILD_LOD,         ## Sample, downsample and mesh a distant LOD tile
+	COMPUTE_LIGHT      ## Light a chunk read from the cache (not active yet, so unshared)
 }
 
 ## Job data structure
+## Also serves as the handle returned by queue_*_job (see cancel_job / reprioritize)
 class ChunkJob extends RefCounted:
 	var job_type: JobType
 	var chunk_pos: Vector3i
 	var priority: float = 0.0
 	var chunk: Chunk = null
-	var region = null  # For region mesh building jobs
-	var region_pos: Vector3i = Vector3i.ZERO  # For region mesh building jobs
+	var snapshot: ChunkSnapshot = null  # Voxel snapshot for mesh building jobs
+	var lod_tile: LodTile = null  # Tile for LOD jobs (chunk_pos holds LodTile.make_key)
 	var terrain_generator = null
 	var mesh_builder = null
 	var result = null
+	var light: ChunkLight = null  # Chunk light computed with generated terrain (if requested)
+	var compute_light: bool = false
 	var completed: bool = false
 	var error: String = ""
+	var cancelled: bool = false  # Set by cancel_job; cancelled results are dropped on the worker
 
 ## Configuration
 var worker_count: int = 4
 var max_jobs_per_frame: int = 8
 
+## Jobs at or above this priority skip the worker deques and go to the urgent lane
+## (queue priority is 1 / distance, so this covers chunks within ~2 chunks of the player)
+const URGENT_PRIORITY: float = 1.0 / 32.0
+
 ## Worker threads
 var workers: Array[Thread] = []
 var worker_running: Array[bool] = []
 
-## Job queues (shared between threads - requires mutex)
-var pending_jobs: Array[ChunkJob] = []
+## Per-worker job deques: the owner pops from the front, idle workers steal from the back
+## Each deque has its own mutex, so workers only contend when stealing
+var worker_queues: Array[Array] = []
+var worker_queue_mutexes: Array[Mutex] = []
+var _next_queue: int = 0  # Round-robin submission target (main thread only)
+
+## Urgent lane: binary max-heap on priority, checked by every worker before its own deque
+var urgent_heap: Array[ChunkJob] = []
+var urgent_mutex: Mutex = Mutex.new()
+
+## Completed jobs (workers -> main thread)
 var completed_jobs: Array[ChunkJob] = []
 
 ## Thread synchronization
-var jobs_mutex: Mutex = Mutex.new()
+## work_semaphore is posted once per queued job; idle workers block on it instead of polling
+var work_semaphore: Semaphore = Semaphore.new()
+var jobs_mutex: Mutex = Mutex.new()  # Guards completed_jobs, pending count and stats
 var should_exit: bool = false
+var _pending_count: int = 0
 
 ## Statistics
 var stats_jobs_queued: int = 0
 var stats_jobs_completed: int = 0
 var stats_generation_jobs: int = 0
 var stats_meshing_jobs: int = 0
+var stats_lod_jobs: int = 0
+var stats_light_jobs: int = 0
 var stats_active_workers: int = 0
+var stats_jobs_stolen: int = 0
+var stats_urgent_jobs: int = 0
+var stats_jobs_cancelled: int = 0
+var stats_jobs_reprioritized: int = 0
 
 func _init(num_workers: int = 4) -> void:
 	worker_count = num_workers
 	print("[ChunkThreadPool] Initializing with %d workers..." % worker_count)
 
+	# Create per-worker deques before any thread can steal from them
+	for i in range(worker_count):
+		worker_queues.append([])
+		worker_queue_mutexes.append(Mutex.new())
+
 	# Start worker threads
 	_start_workers()
 
@@ -74,7 +108,9 @@ func _worker_thread_function(worker_id: int) -> void:
 	print("[ChunkThreadPool] Worker %d running" % worker_id)
 
 	while true:
-		# Check if we should exit
+		# Sleep until a job is queued (or shutdown posts a wakeup)
+		work_semaphore.wait()
+
 		jobs_mutex.lock()
 		var should_stop := should_exit
 		jobs_mutex.unlock()
@@ -82,32 +118,128 @@ func _worker_thread_function(worker_id: int) -> void:
 		if should_stop:
 			break
 
-		# Get next job from queue
-		var job: ChunkJob = null
+		# Each post accounts for exactly one job; if it was cleared meanwhile, go back to sleep
+		var job := _take_job(worker_id)
+		if not job:
+			continue
 
-		jobs_mutex.lock()
-		if pending_jobs.size() > 0:
-			# OPTIMIZATION: Don't sort every time! Jobs are inserted in priority order.
-			# Just take the first job (highest priority already at front)
-			job = pending_jobs.pop_front()
-		jobs_mutex.unlock()
+		# Cancelled between the lane and this worker (cancel_job didn't find it to count it)
+		if job.cancelled:
+			jobs_mutex.lock()
+			stats_jobs_cancelled += 1
+			jobs_mutex.unlock()
+			continue
 
-		# Process job if we got one
-		if job:
-			_process_job(job, worker_id)
+		_process_job(job, worker_id)
 
-			# Add to completed queue
+		# Drop stale results (cancelled while running) without involving the main thread
+		if job.cancelled:
 			jobs_mutex.lock()
-			completed_jobs.append(job)
-			stats_jobs_completed += 1
+			stats_jobs_cancelled += 1
 			jobs_mutex.unlock()
-		else:
-			# No jobs available, sleep briefly to avoid busy-waiting
-			# OPTIMIZATION: Could use semaphore here, but 1ms is acceptable for now
-			OS.delay_msec(1)
+			continue
+
+		# Add to completed queue
+		jobs_mutex.lock()
+		completed_jobs.append(job)
+		stats_jobs_completed += 1
+		jobs_mutex.unlock()
 
 	print("[ChunkThreadPool] Worker %d exiting" % worker_id)
 
+## Take the next job for a worker: urgent lane, then own deque, then steal from other deques
+func _take_job(worker_id: int) -> ChunkJob:
+	var job: ChunkJob = null
+	var stolen := false
+
+	urgent_mutex.lock()
+	if not urgent_heap.is_empty():
+		job = _heap_pop()
+	urgent_mutex.unlock()
+
+	if not job:
+		var own_mutex := worker_queue_mutexes[worker_id]
+		own_mutex.lock()
+		if not worker_queues[worker_id].is_empty():
+			job = worker_queues[worker_id].pop_front()
+		own_mutex.unlock()
+
+	if not job:
+		for offset in range(1, worker_count):
+			var victim := (worker_id + offset) % worker_count
+			worker_queue_mutexes[victim].lock()
+			if not worker_queues[victim].is_empty():
+				job = worker_queues[victim].pop_back()
+			worker_queue_mutexes[victim].unlock()
+			if job:
+				stolen = true
+				break
+
+	if job:
+		jobs_mutex.lock()
+		_pending_count -= 1
+		if stolen:
+			stats_jobs_stolen += 1
+		jobs_mutex.unlock()
+
+	return job
+
+## Submit a job to the urgent lane or the next worker deque, then wake one worker
+func _submit_job(job: ChunkJob) -> void:
+	if job.priority >= URGENT_PRIORITY:
+		urgent_mutex.lock()
+		_heap_push(job)
+		urgent_mutex.unlock()
+	else:
+		var target := _next_queue
+		_next_queue = (_next_queue + 1) % worker_count
+		worker_queue_mutexes[target].lock()
+		worker_queues[target].append(job)
+		worker_queue_mutexes[target].unlock()
+
+	jobs_mutex.lock()
+	_pending_count += 1
+	stats_jobs_queued += 1
+	if job.priority >= URGENT_PRIORITY:
+		stats_urgent_jobs += 1
+	jobs_mutex.unlock()
+
+	work_semaphore.post()
+
+## Push onto the urgent max-heap (urgent_mutex must be held)
+func _heap_push(job: ChunkJob) -> void:
+	urgent_heap.append(job)
+	var i := urgent_heap.size() - 1
+	while i > 0:
+		var parent := (i - 1) >> 1
+		if urgent_heap[parent].priority >= job.priority:
+			break
+		urgent_heap[i] = urgent_heap[parent]
+		i = parent
+	urgent_heap[i] = job
+
+## Pop the highest-priority job from the urgent max-heap (urgent_mutex must be held)
+func _heap_pop() -> ChunkJob:
+	var top: ChunkJob = urgent_heap[0]
+	var last: ChunkJob = urgent_heap.pop_back()
+	var size := urgent_heap.size()
+	if size == 0:
+		return top
+
+	var i := 0
+	while true:
+		var child := i * 2 + 1
+		if child >= size:
+			break
+		if child + 1 < size and urgent_heap[child + 1].priority > urgent_heap[child].priority:
+			child += 1
+		if urgent_heap[child].priority <= last.priority:
+			break
+		urgent_heap[i] = urgent_heap[child]
+		i = child
+	urgent_heap[i] = last
+	return top
+
 ## Process a single job
 func _process_job(job: ChunkJob, worker_id: int) -> void:
 	match job.job_type:
@@ -115,8 +247,10 @@ func _process_job(job: ChunkJob, worker_id: int) -> void:
 			_process_generation_job(job, worker_id)
 		JobType.BUILD_MESH:
 			_process_meshing_job(job, worker_id)
-		JobType.BUILD_REGION_MESH:
-			_process_region_rebuild_job(job, worker_id)
+		JobType.BUILD_LOD:
+			_process_lod_job(job, worker_id)
+		JobType.COMPUTE_LIGHT:
+			_process_light_job(job, worker_id)
 
 ## Process terrain generation job
 func _process_generation_job(job: ChunkJob, worker_id: int) -> void:
@@ -128,202 +262,219 @@ func _process_generation_job(job: ChunkJob, worker_id: int) -> void:
 	# Generate terrain data (thread-safe - noise generation is stateless)
 	var voxel_data: VoxelData = job.terrain_generator.generate_chunk(job.chunk_pos)
 
+	# Light the chunk on its own while still on the worker (enclosed chunks stay dark)
+	if job.compute_light and not voxel_data.is_empty() and not voxel_data.is_enclosed:
+		job.light = LightEngine.compute_chunk_light(voxel_data, job.terrain_generator)
+
 	job.result = voxel_data
 	job.completed = true
 
 ## Process mesh building job
 func _process_meshing_job(job: ChunkJob, worker_id: int) -> void:
-	if not job.mesh_builder or not job.chunk:
-		job.error = "No mesh builder or chunk provided"
+	if not job.mesh_builder or not job.snapshot:
+		job.error = "No mesh builder or snapshot provided"
 		job.completed = true
 		return
 
-	# Build mesh data (thread-safe - reads chunk data without modification)
+	# Build mesh data (thread-safe - reads only the snapshot captured at queue time)
 	# Note: We build the mesh data but don't create MeshInstance3D (that must be on main thread)
-	var mesh_data: Dictionary = job.mesh_builder.build_mesh_data(job.chunk)
+	var mesh_data: Dictionary = job.mesh_builder.build_mesh_data(job.snapshot)
 
 	job.result = mesh_data
 	job.completed = true
 
-## Process region mesh building job
-## This builds the combined mesh arrays for a region on a worker thread
-func _process_region_rebuild_job(job: ChunkJob, worker_id: int) -> void:
-	if not job.mesh_builder or not job.region:
-		job.error = "No mesh builder or region provided"
+## Process LOD tile job: build the tile's mip buffer from the generator, then mesh it
+func _process_lod_job(job: ChunkJob, worker_id: int) -> void:
+	if not job.lod_tile or not job.terrain_generator or not job.mesh_builder:
+		job.error = "No LOD tile, terrain generator or mesh builder provided"
 		job.completed = true
 		return
 
-	var region = job.region
-	var mesh_builder = job.mesh_builder
-
-	# Build combined mesh arrays on worker thread
-	# This is the expensive operation we want to offload from main thread
-	var combined_arrays: Array = []
-	combined_arrays.resize(Mesh.ARRAY_MAX)
-
-	# Initialize arrays
-	var vertices := PackedVector3Array()
-	var normals := PackedVector3Array()
-	var colors := PackedColorArray()
-	var uvs := PackedVector2Array()
-	var indices := PackedInt32Array()
-
-	var vertex_offset := 0
-	var total_chunks_processed := 0
-	var cache_hits := 0
-	var cache_misses := 0
-
-	# Get chunks from region (thread-safe since we're just reading)
-	var chunks_snapshot: Array = region.chunks.values()
-
-	# Process each chunk in the region
-	for chunk in chunks_snapshot:
-		# Skip invalid or empty chunks
-		if not chunk or not is_instance_valid(chunk) or chunk.is_empty():
-			continue
-
-		# Skip chunks that aren't fully ready
-		if chunk.state != Chunk.State.ACTIVE:
-			continue
-
-		# Use cached mesh arrays if available (MAJOR OPTIMIZATION)
-		var chunk_arrays: Array = []
-		if not chunk.cached_mesh_arrays.is_empty():
-			# Cache hit - use pre-built arrays (FAST!)
-			chunk_arrays = chunk.cached_mesh_arrays
-			cache_hits += 1
-		else:
-			# Cache miss - build mesh arrays and cache them (SLOW!)
-			chunk_arrays = mesh_builder.build_mesh_arrays(chunk)
-			chunk.cached_mesh_arrays = chunk_arrays
-			cache_misses += 1
-
-		if chunk_arrays.is_empty():
-			continue
-
-		# Get the arrays from the chunk mesh data (handle null values)
-		var chunk_vertices: PackedVector3Array = chunk_arrays[Mesh.ARRAY_VERTEX] if (chunk_arrays.size() > Mesh.ARRAY_VERTEX and chunk_arrays[Mesh.ARRAY_VERTEX] != null) else PackedVector3Array()
-		var chunk_normals: PackedVector3Array = chunk_arrays[Mesh.ARRAY_NORMAL] if (chunk_arrays.size() > Mesh.ARRAY_NORMAL and chunk_arrays[Mesh.ARRAY_NORMAL] != null) else PackedVector3Array()
-		var chunk_colors: PackedColorArray = chunk_arrays[Mesh.ARRAY_COLOR] if (chunk_arrays.size() > Mesh.ARRAY_COLOR and chunk_arrays[Mesh.ARRAY_COLOR] != null) else PackedColorArray()
-		var chunk_uvs: PackedVector2Array = chunk_arrays[Mesh.ARRAY_TEX_UV] if (chunk_arrays.size() > Mesh.ARRAY_TEX_UV and chunk_arrays[Mesh.ARRAY_TEX_UV] != null) else PackedVector2Array()
-		var chunk_indices: PackedInt32Array = chunk_arrays[Mesh.ARRAY_INDEX] if (chunk_arrays.size() > Mesh.ARRAY_INDEX and chunk_arrays[Mesh.ARRAY_INDEX] != null) else PackedInt32Array()
-
-		if chunk_vertices.is_empty():
-			continue
-
-		# Offset vertices by chunk position (relative to region origin)
-		var chunk_offset: Vector3 = chunk.get_world_position() - region.get_region_world_position()
-
-		for i in range(chunk_vertices.size()):
-			vertices.append(chunk_vertices[i] + chunk_offset)
-
-		# Append normals
-		normals.append_array(chunk_normals)
-
-		# Append colors
-		colors.append_array(chunk_colors)
-
-		# Append UVs
-		uvs.append_array(chunk_uvs)
-
-		# Append indices (with vertex offset applied)
-		for idx in chunk_indices:
-			indices.append(idx + vertex_offset)
-
-		vertex_offset += chunk_vertices.size()
-		total_chunks_processed += 1
-
-	# Build the combined arrays - only include arrays that have proper data
-	if not vertices.is_empty():
-		combined_arrays[Mesh.ARRAY_VERTEX] = vertices
-
-		# Only include normals if we have them for all vertices
-		if normals.size() == vertices.size():
-			combined_arrays[Mesh.ARRAY_NORMAL] = normals
-
-		# Only include colors if we have them for all vertices
-		if colors.size() == vertices.size():
-			combined_arrays[Mesh.ARRAY_COLOR] = colors
-
-		# Only include UVs if we have them for all vertices
-		if uvs.size() == vertices.size():
-			combined_arrays[Mesh.ARRAY_TEX_UV] = uvs
+	var padded: PackedByteArray = job.lod_tile.build_padded(job.terrain_generator)
+	job.result = job.mesh_builder.build_padded_mesh_data(padded, job.lod_tile.size_y)
+	job.completed = true
 
-		# Always include indices if we have them
-		if not indices.is_empty():
-			combined_arrays[Mesh.ARRAY_INDEX] = indices
+## Process light job: the same per-chunk pass generation jobs run on new terrain
+func _process_light_job(job: ChunkJob, worker_id: int) -> void:
+	if not job.chunk or not job.terrain_generator:
+		job.error = "No chunk or terrain generator provided"
+		job.completed = true
+		return
 
-	# Store results
-	job.result = {
-		"combined_arrays": combined_arrays,
-		"vertex_count": vertices.size(),
-		"chunk_count": total_chunks_processed,
-		"cache_hits": cache_hits,
-		"cache_misses": cache_misses
-	}
+	var voxel_data := job.chunk.voxel_data
+	if not voxel_data.is_empty() and not voxel_data.is_enclosed:
+		job.light = LightEngine.compute_chunk_light(voxel_data, job.terrain_generator)
 	job.completed = true
 
-## Queue a terrain generation job
-func queue_generation_job(chunk_pos: Vector3i, terrain_generator, priority: float = 0.0) -> void:
+## Queue a terrain generation job (compute_light also lights the generated chunk)
+## Returns the job handle (for cancel_job / completion matching)
+func queue_generation_job(chunk_pos: Vector3i, terrain_generator, priority: float = 0.0, compute_light: bool = false) -> ChunkJob:
 	var job := ChunkJob.new()
 	job.job_type = JobType.GENERATE_TERRAIN
 	job.chunk_pos = chunk_pos
 	job.terrain_generator = terrain_generator
 	job.priority = priority
+	job.compute_light = compute_light
 
 	jobs_mutex.lock()
-	# OPTIMIZATION: Insert job in priority order to avoid sorting on every fetch
-	_insert_job_sorted(job)
-	stats_jobs_queued += 1
 	stats_generation_jobs += 1
 	jobs_mutex.unlock()
 
-## Queue a mesh building job
-func queue_meshing_job(chunk: Chunk, mesh_builder, priority: float = 0.0) -> void:
+	_submit_job(job)
+	return job
+
+## Queue a mesh building job (call on main thread - captures the voxel snapshot)
+## mesh_offset shifts the vertices (region-local meshes for region batching)
+## Returns the job handle (for cancel_job / completion matching)
+func queue_meshing_job(chunk: Chunk, mesh_builder, priority: float = 0.0, mesh_offset: Vector3 = Vector3.ZERO) -> ChunkJob:
 	var job := ChunkJob.new()
 	job.job_type = JobType.BUILD_MESH
 	job.chunk_pos = chunk.position
 	job.chunk = chunk
+	job.snapshot = ChunkSnapshot.capture(chunk, mesh_offset)
 	job.mesh_builder = mesh_builder
 	job.priority = priority
 
 	jobs_mutex.lock()
-	# OPTIMIZATION: Insert job in priority order to avoid sorting on every fetch
-	_insert_job_sorted(job)
-	stats_jobs_queued += 1
 	stats_meshing_jobs += 1
 	jobs_mutex.unlock()
 
-## Queue a region mesh building job
-func queue_region_rebuild_job(region, region_pos: Vector3i, mesh_builder, priority: float = 0.0) -> void:
+	_submit_job(job)
+	return job
+
+## Queue a light job for a chunk loaded from the cache (not active yet - nothing may
+## write its voxels until the job completes)
+## Returns the job handle (for cancel_job / completion matching)
+func queue_light_job(chunk: Chunk, terrain_generator, priority: float = 0.0) -> ChunkJob:
+	var job := ChunkJob.new()
+	job.job_type = JobType.COMPUTE_LIGHT
+	job.chunk_pos = chunk.position
+	job.chunk = chunk
+	job.terrain_generator = terrain_generator
+	job.priority = priority
+
+	jobs_mutex.lock()
+	stats_light_jobs += 1
+	jobs_mutex.unlock()
+
+	_submit_job(job)
+	return job
+
+## Queue an LOD tile job
+## Returns the job handle (for cancel_job / completion matching)
+func queue_lod_job(tile: LodTile, terrain_generator, mesh_builder, priority: float = 0.0) -> ChunkJob:
 	var job := ChunkJob.new()
-	job.job_type = JobType.BUILD_REGION_MESH
-	job.region_pos = region_pos
-	job.region = region
+	job.job_type = JobType.BUILD_LOD
+	job.chunk_pos = LodTile.make_key(tile.level, tile.tile_pos)
+	job.lod_tile = tile
+	job.terrain_generator = terrain_generator
 	job.mesh_builder = mesh_builder
 	job.priority = priority
 
 	jobs_mutex.lock()
-	# OPTIMIZATION: Insert job in priority order to avoid sorting on every fetch
-	_insert_job_sorted(job)
-	stats_jobs_queued += 1
+	stats_lod_jobs += 1
 	jobs_mutex.unlock()
 
-## Insert job in priority order (higher priority at front)
-## O(n) insertion is much better than O(n log n) sorting on every fetch
-func _insert_job_sorted(job: ChunkJob) -> void:
-	# Find insertion point using binary search for O(log n) insertion
-	var left := 0
-	var right := pending_jobs.size()
-
-	while left < right:
-		var mid := (left + right) / 2
-		if pending_jobs[mid].priority < job.priority:
-			right = mid
+	_submit_job(job)
+	return job
+
+## Cancel a queued or running job (call from main thread)
+## Pending jobs are removed from their lane immediately; running jobs finish but their
+## result is dropped on the worker. Returns true if the job was still pending.
+## A cancelled job is counted once, where it is dropped (here only if it was pending)
+func cancel_job(job: ChunkJob) -> bool:
+	if not job or job.cancelled:
+		return false
+	job.cancelled = true
+
+	var removed := false
+	urgent_mutex.lock()
+	var heap_index := urgent_heap.find(job)
+	if heap_index >= 0:
+		# Re-heapify after removal (urgent lane is small)
+		urgent_heap.remove_at(heap_index)
+		_heapify()
+		removed = true
+	urgent_mutex.unlock()
+
+	if not removed:
+		for i in range(worker_queues.size()):
+			worker_queue_mutexes[i].lock()
+			var index: int = worker_queues[i].find(job)
+			if index >= 0:
+				worker_queues[i].remove_at(index)
+				removed = true
+			worker_queue_mutexes[i].unlock()
+			if removed:
+				break
+
+	if removed:
+		jobs_mutex.lock()
+		stats_jobs_cancelled += 1
+		_pending_count -= 1
+		jobs_mutex.unlock()
+
+	# Consume the job's wakeup (if a worker already woke for it, it finds nothing and sleeps again)
+	if removed:
+		work_semaphore.try_wait()
+
+	return removed
+
+## Re-score all pending jobs (call from main thread, e.g. when the camera moves or turns)
+## scorer: Callable(job: ChunkJob) -> float; a negative score cancels the job
+## Jobs are redistributed: urgent ones into the heap lane, the rest dealt highest-first across deques
+func reprioritize(scorer: Callable) -> void:
+	# Lock every lane (workers never hold more than one lane lock, so this can't deadlock)
+	urgent_mutex.lock()
+	for m in worker_queue_mutexes:
+		m.lock()
+
+	var jobs: Array[ChunkJob] = []
+	jobs.append_array(urgent_heap)
+	for queue in worker_queues:
+		jobs.append_array(queue)
+		queue.clear()
+	urgent_heap.clear()
+
+	var normal_jobs: Array[ChunkJob] = []
+	var dropped := 0
+	for job in jobs:
+		var score: float = scorer.call(job)
+		if score < 0.0:
+			job.cancelled = true
+			dropped += 1
+			continue
+		job.priority = score
+		if score >= URGENT_PRIORITY:
+			urgent_heap.append(job)
 		else:
-			left = mid + 1
+			normal_jobs.append(job)
+	_heapify()
+
+	# Owners pop from the front, so deal highest priority first
+	normal_jobs.sort_custom(func(a, b): return a.priority > b.priority)
+	for i in range(normal_jobs.size()):
+		worker_queues[i % worker_count].append(normal_jobs[i])
 
-	pending_jobs.insert(left, job)
+	for m in worker_queue_mutexes:
+		m.unlock()
+	urgent_mutex.unlock()
+
+	jobs_mutex.lock()
+	_pending_count -= dropped
+	stats_jobs_cancelled += dropped
+	stats_jobs_reprioritized += jobs.size()
+	jobs_mutex.unlock()
+
+	for i in range(dropped):
+		work_semaphore.try_wait()
+
+## Restore the heap property over the whole urgent lane (urgent_mutex must be held)
+func _heapify() -> void:
+	var jobs := urgent_heap.duplicate()
+	urgent_heap.clear()
+	for job in jobs:
+		_heap_push(job)
 
 ## Get completed jobs (call from main thread)
 func get_completed_jobs(max_count: int = -1) -> Array[ChunkJob]:
@@ -334,9 +485,13 @@ func get_completed_jobs(max_count: int = -1) -> Array[ChunkJob]:
 	if max_count < 0:
 		max_count = completed_jobs.size()
 
-	var count := mini(max_count, completed_jobs.size())
-	for i in range(count):
-		jobs.append(completed_jobs.pop_front())
+	# Skip results cancelled after the worker finished them
+	while jobs.size() < max_count and not completed_jobs.is_empty():
+		var job: ChunkJob = completed_jobs.pop_front()
+		if job.cancelled:
+			stats_jobs_cancelled += 1
+		else:
+			jobs.append(job)
 
 	jobs_mutex.unlock()
 
@@ -357,7 +512,7 @@ func process_completed_jobs(callback: Callable, max_per_frame: int = -1) -> int:
 ## Get number of pending jobs
 func get_pending_job_count() -> int:
 	jobs_mutex.lock()
-	var count := pending_jobs.size()
+	var count := _pending_count
 	jobs_mutex.unlock()
 	return count
 
@@ -370,15 +525,36 @@ func get_completed_job_count() -> int:
 
 ## Clear all pending jobs
 func clear_pending_jobs() -> void:
+	var removed := 0
+
+	urgent_mutex.lock()
+	removed += urgent_heap.size()
+	urgent_heap.clear()
+	urgent_mutex.unlock()
+
+	for i in range(worker_queues.size()):
+		worker_queue_mutexes[i].lock()
+		removed += worker_queues[i].size()
+		worker_queues[i].clear()
+		worker_queue_mutexes[i].unlock()
+
 	jobs_mutex.lock()
-	pending_jobs.clear()
+	_pending_count -= removed
 	jobs_mutex.unlock()
 
+	# Consume the wakeups for the removed jobs (workers that already woke find nothing and sleep again)
+	for i in range(removed):
+		work_semaphore.try_wait()
+
 ## Get statistics
 func get_stats() -> Dictionary:
 	jobs_mutex.lock()
-	var pending_count := pending_jobs.size()
+	var pending_count := _pending_count
 	var completed_count := completed_jobs.size()
+	var stolen_count := stats_jobs_stolen
+	var urgent_count := stats_urgent_jobs
+	var cancelled_count := stats_jobs_cancelled
+	var reprioritized_count := stats_jobs_reprioritized
 	jobs_mutex.unlock()
 
 	return {
@@ -388,7 +564,13 @@ func get_stats() -> Dictionary:
 		"total_queued": stats_jobs_queued,
 		"total_completed": stats_jobs_completed,
 		"generation_jobs": stats_generation_jobs,
-		"meshing_jobs": stats_meshing_jobs
+		"meshing_jobs": stats_meshing_jobs,
+		"lod_jobs": stats_lod_jobs,
+		"light_jobs": stats_light_jobs,
+		"stolen_jobs": stolen_count,
+		"urgent_jobs": urgent_count,
+		"cancelled_jobs": cancelled_count,
+		"reprioritized_jobs": reprioritized_count
 	}
 
 ## Print statistics
@@ -403,16 +585,24 @@ func print_stats() -> void:
 	print("  Total Completed: %d" % stats.total_completed)
 	print("  Generation Jobs: %d" % stats.generation_jobs)
 	print("  Meshing Jobs: %d" % stats.meshing_jobs)
+	print("  LOD Jobs: %d" % stats.lod_jobs)
+	print("  Light Jobs: %d" % stats.light_jobs)
+	print("  Urgent Jobs: %d" % stats.urgent_jobs)
+	print("  Stolen Jobs: %d" % stats.stolen_jobs)
+	print("  Cancelled Jobs: %d" % stats.cancelled_jobs)
+	print("  Reprioritized Jobs: %d" % stats.reprioritized_jobs)
 	print("========================================")
 
 ## Shutdown thread pool (call before freeing)
 func shutdown() -> void:
 	print("[ChunkThreadPool] Shutting down thread pool...")
 
-	# Signal workers to exit
+	# Signal workers to exit and wake every sleeping worker so it sees the flag
 	jobs_mutex.lock()
 	should_exit = true
 	jobs_mutex.unlock()
+	for i in range(workers.size()):
+		work_semaphore.post()
 
 	# Wait for all workers to finish
 	for i in range(workers.size()):
@@ -424,8 +614,11 @@ func shutdown() -> void:
 	worker_running.clear()
 
 	# Clear job queues
+	urgent_heap.clear()
+	for queue in worker_queues:
+		queue.clear()
 	jobs_mutex.lock()
-	pending_jobs.clear()
+	_pending_count = 0
 	completed_jobs.clear()
 	jobs_mutex.unlock()
 
@@ -0,0 +1,149 @@
+## FarTerrain - Heightfield-only horizon beyond the voxel and LOD terrain
+## Nested ClipmapRings sample TerrainGenerator surface heights (no voxels) on grids whose
+## spacing doubles per ring: with 64-cell rings, ring 0 spans about 2x the inner radius and
+## every further ring doubles that, so a few rings reach several kilometers
+##
+## Each ring draws only outside the next finer ring's window, and all rings leave a hole
+## around the player where chunks and LOD tiles are drawn instead
+## Rings slide incrementally as the player moves, within a per-update sample budget
+class_name FarTerrain
+extends RefCounted
+
+## Cells per ring side (even, so the window center lands on a sample)
+const RING_CELLS: int = 64
+
+## Coarsest sample spacing ring 0 may start at (blocks)
+const MIN_SPACING: int = VoxelData.CHUNK_SIZE_XZ
+
+## Stop sliding further rings in an update once this many samples were taken
+## (a ring always slides as a whole, so its texture never mixes two windows)
+const MAX_SAMPLES_PER_UPDATE: int = 4096
+
+## Chunk manager reference (generator, configuration)
+var chunk_manager: ChunkManager = null
+
+## Parent node of the ring instances
+var root: Node3D = null
+
+## Rings from finest to coarsest
+var rings: Array[ClipmapRing] = []
+
+## Grid mesh shared by every ring
+var grid_mesh: ArrayMesh = null
+
+## Surface block type per terrain height (TerrainGenerator.get_column_types is pure)
+var _column_types: Dictionary = {}
+
+## Block colors are copied from the mesh builder once it exists
+var _has_block_colors: bool = false
+
+## Statistics
+var stats_samples: int = 0
+var stats_slides: int = 0
+
+func _init(manager: ChunkManager = null, ring_count: int = 3, inner_radius: float = 0.0) -> void:
+	chunk_manager = manager
+	root = Node3D.new()
+	root.name = "FarTerrain"
+	if chunk_manager:
+		chunk_manager.add_child(root)
+
+	grid_mesh = _create_grid_mesh(RING_CELLS)
+
+	# Ring 0 must reach past the hole, or nothing would be drawn next to it
+	var spacing := MIN_SPACING
+	while RING_CELLS / 2 * spacing <= inner_radius:
+		spacing *= 2
+
+	for level in range(ring_count):
+		var ring := ClipmapRing.new(level, spacing << level, RING_CELLS)
+		ring.set_hole(Vector3.ZERO, inner_radius)
+		ring.mesh_instance = MeshInstance3D.new()
+		ring.mesh_instance.mesh = grid_mesh
+		ring.mesh_instance.material_override = ring.material
+		ring.mesh_instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_OFF
+		ring.mesh_instance.visible = false  # Until the first slide fills the heightmap
+		root.add_child(ring.mesh_instance)
+		rings.append(ring)
+
+	print("[FarTerrain] Initialized %d rings (spacing %d-%d blocks, reach %d blocks)" % [
+		ring_count, spacing, spacing << (ring_count - 1), RING_CELLS / 2 * (spacing << (ring_count - 1))])
+
+## Slide rings that fell behind the player (finest first, within the sample budget)
+func update(player_position: Vector3, inner_radius: float) -> void:
+	if not chunk_manager.terrain_generator or not chunk_manager.mesh_builder:
+		return
+
+	# Same color table as the chunk shaders
+	if not _has_block_colors:
+		var block_colors = chunk_manager.mesh_builder.default_material.get_shader_parameter("block_colors")
+		for ring in rings:
+			ring.material.set_shader_parameter("block_colors", block_colors)
+		_has_block_colors = true
+
+	var samples := 0
+	var slid := false
+	for ring in rings:
+		if samples >= MAX_SAMPLES_PER_UPDATE:
+			break
+		var target := ring.get_target_origin(player_position)
+		if ring.is_filled and target == ring.sample_origin:
+			continue
+		samples += ring.slide_to(target, chunk_manager.terrain_generator, _column_types)
+		ring.mesh_instance.visible = true
+		slid = true
+		stats_slides += 1
+
+	stats_samples += samples
+
+	# The hole follows the player every update; the inner windows only change on a slide
+	for i in range(rings.size()):
+		rings[i].set_hole(player_position, inner_radius)
+		if slid:
+			rings[i].set_inner_rect(rings[i - 1].get_world_rect() if i > 0 else Rect2())
+
+## Hide every ring and forget its samples (the next update refills them, e.g. for a new seed)
+func clear() -> void:
+	for ring in rings:
+		ring.is_filled = false
+		ring.mesh_instance.visible = false
+	_column_types.clear()
+
+## Get far terrain statistics
+func get_stats() -> Dictionary:
+	return {
+		"rings": rings.size(),
+		"reach": RING_CELLS / 2 * rings[-1].spacing if not rings.is_empty() else 0,
+		"samples": stats_samples,
+		"slides": stats_slides
+	}
+
+## Flat (cells + 1)^2 grid with integer cell coordinates in x/z, displaced by the shader
+func _create_grid_mesh(cell_count: int) -> ArrayMesh:
+	var side := cell_count + 1
+	var vertices := PackedVector3Array()
+	var indices := PackedInt32Array()
+	vertices.resize(side * side)
+	indices.resize(cell_count * cell_count * 6)
+
+	for z in range(side):
+		for x in range(side):
+			vertices[x + z * side] = Vector3(x, 0.0, z)
+
+	var i := 0
+	for z in range(cell_count):
+		for x in range(cell_count):
+			var v := x + z * side
+			# Two clockwise triangles seen from above
+			indices[i] = v; indices[i + 1] = v + 1; indices[i + 2] = v + side
+			indices[i + 3] = v + 1; indices[i + 4] = v + side + 1; indices[i + 5] = v + side
+			i += 6
+
+	var arrays: Array = []
+	arrays.resize(Mesh.ARRAY_MAX)
+	arrays[Mesh.ARRAY_VERTEX] = vertices
+	arrays[Mesh.ARRAY_INDEX] = indices
+
+	var mesh := ArrayMesh.new()
+	mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, arrays)
+	return mesh
@@ -0,0 +1,171 @@
+## FrustumCuller - Tests every registered AABB against the camera frustum each frame
+## Bounds live in a structure-of-arrays table (center/extent PackedFloat32Arrays indexed by
+## slot), so a full pass is one tight loop over contiguous memory with no per-object
+## dictionary or node access. Replaces the old frame-spread culling, where only 1/8 of
+## regions were tested per frame and regions popped in after fast camera turns
+##
+## Usage: add() a bounds box to get a slot, update() it when the box changes, then call
+## cull() once per frame and apply get_changed_slots() (visibility only changes there)
+class_name FrustumCuller
+extends RefCounted
+
+## Bounds table (one entry per slot): box center and half-size per axis
+var center_x: PackedFloat32Array = PackedFloat32Array()
+var center_y: PackedFloat32Array = PackedFloat32Array()
+var center_z: PackedFloat32Array = PackedFloat32Array()
+var extent_x: PackedFloat32Array = PackedFloat32Array()
+var extent_y: PackedFloat32Array = PackedFloat32Array()
+var extent_z: PackedFloat32Array = PackedFloat32Array()
+
+## Visibility per slot from the last cull (1 = inside or intersecting the frustum)
+var visible: PackedByteArray = PackedByteArray()
+
+## 1 if the slot is in use
+var used: PackedByteArray = PackedByteArray()
+
+## Free slots for reuse (removed entries)
+var _free_slots: PackedInt32Array = PackedInt32Array()
+
+## Slots whose visibility changed in the last cull
+var _changed_slots: PackedInt32Array = PackedInt32Array()
+
+## Plane data of the last cull (nx, ny, nz, d per plane), to skip passes when nothing moved
+var _last_planes: PackedFloat32Array = PackedFloat32Array()
+var _bounds_dirty: bool = true
+
+## Statistics
+var stats_visible: int = 0
+var stats_tested: int = 0
+var stats_last_cull_usec: int = 0
+
+## Register a box, returns its slot (new slots start visible until the next cull)
+func add(aabb: AABB) -> int:
+	var slot: int
+	if not _free_slots.is_empty():
+		slot = _free_slots[_free_slots.size() - 1]
+		_free_slots.resize(_free_slots.size() - 1)
+	else:
+		slot = used.size()
+		var new_size := slot + 1
+		center_x.resize(new_size)
+		center_y.resize(new_size)
+		center_z.resize(new_size)
+		extent_x.resize(new_size)
+		extent_y.resize(new_size)
+		extent_z.resize(new_size)
+		visible.resize(new_size)
+		used.resize(new_size)
+
+	used[slot] = 1
+	visible[slot] = 1
+	update(slot, aabb)
+	return slot
+
+## Update the box of a slot
+func update(slot: int, aabb: AABB) -> void:
+	var half := aabb.size * 0.5
+	var center := aabb.position + half
+	center_x[slot] = center.x
+	center_y[slot] = center.y
+	center_z[slot] = center.z
+	extent_x[slot] = half.x
+	extent_y[slot] = half.y
+	extent_z[slot] = half.z
+	_bounds_dirty = true
+
+## Release a slot
+func remove(slot: int) -> void:
+	if slot < 0 or slot >= used.size() or not used[slot]:
+		return
+	used[slot] = 0
+	visible[slot] = 0
+	_free_slots.append(slot)
+
+## Drop every slot
+func clear() -> void:
+	center_x.clear()
+	center_y.clear()
+	center_z.clear()
+	extent_x.clear()
+	extent_y.clear()
+	extent_z.clear()
+	visible.clear()
+	used.clear()
+	_free_slots.clear()
+	_changed_slots.clear()
+	_last_planes.clear()
+	_bounds_dirty = true
+
+## Check the visibility of a slot from the last cull
+func is_visible(slot: int) -> bool:
+	return slot >= 0 and slot < visible.size() and visible[slot] == 1
+
+## Slots whose visibility changed in the last cull
+func get_changed_slots() -> PackedInt32Array:
+	return _changed_slots
+
+## Test every slot against the frustum planes (Camera3D.get_frustum(), normals point out)
+## A box is outside if its nearest point along some plane normal lies in front of that plane:
+##   n . center - |n| . extent > d
+## Returns true if any slot changed visibility
+func cull(frustum: Array[Plane]) -> bool:
+	var start := Time.get_ticks_usec()
+	_changed_slots.clear()
+
+	# Flatten planes (nx, ny, nz, d) and skip the pass if neither camera nor bounds changed
+	var planes := PackedFloat32Array()
+	planes.resize(frustum.size() * 4)
+	for p in range(frustum.size()):
+		var plane: Plane = frustum[p]
+		planes[p * 4] = plane.normal.x
+		planes[p * 4 + 1] = plane.normal.y
+		planes[p * 4 + 2] = plane.normal.z
+		planes[p * 4 + 3] = plane.d
+	if not _bounds_dirty and planes == _last_planes:
+		return false
+	_last_planes = planes
+	_bounds_dirty = false
+
+	var plane_count := frustum.size()
+	var slot_count := used.size()
+	var visible_count := 0
+
+	for slot in range(slot_count):
+		if not used[slot]:
+			continue
+
+		var cx: float = center_x[slot]
+		var cy: float = center_y[slot]
+		var cz: float = center_z[slot]
+		var ex: float = extent_x[slot]
+		var ey: float = extent_y[slot]
+		var ez: float = extent_z[slot]
+
+		var inside := 1
+		for p in range(plane_count):
+			var i := p * 4
+			var nx: float = planes[i]
+			var ny: float = planes[i + 1]
+			var nz: float = planes[i + 2]
+			if nx * cx + ny * cy + nz * cz - (absf(nx) * ex + absf(ny) * ey + absf(nz) * ez) > planes[i + 3]:
+				inside = 0
+				break
+
+		visible_count += inside
+		if visible[slot] != inside:
+			visible[slot] = inside
+			_changed_slots.append(slot)
+
+	stats_visible = visible_count
+	stats_tested = slot_count - _free_slots.size()
+	stats_last_cull_usec = Time.get_ticks_usec() - start
+	return not _changed_slots.is_empty()
+
+## Get culling statistics
+func get_stats() -> Dictionary:
+	return {
+		"slots": used.size() - _free_slots.size(),
+		"visible": stats_visible,
+		"tested": stats_tested,
+		"last_cull_ms": stats_last_cull_usec / 1000.0
+	}
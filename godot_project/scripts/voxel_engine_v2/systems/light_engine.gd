@@ -0,0 +1,499 @@
+## LightEngine - Block light and sunlight propagation over per-chunk ChunkLight storage
+## Light is baked into mesh vertices, so torches and lava light caves without any
+## OmniLight3D nodes; the engine only has to keep the 4-bit levels up to date
+##
+## Two stages:
+## - compute_chunk_light (static, thread-safe) lights a generated chunk on its own, on the
+##   worker that generated it: sunlight falls down each column (open to the sky above the
+##   generator's terrain height), then both channels flood-fill within the chunk
+## - on the main thread, on_chunk_loaded stitches a chunk to its loaded face neighbors and
+##   on_voxels_changed updates light after edits, with BFS add/remove queues that cross
+##   chunk borders (Minecraft-style removal: darken what the old light fed, then refill)
+##   The stitch also removes sunlight a column got from the generator's heights where the
+##   loaded chunk above (e.g. a player-built roof) doesn't let it through
+##
+## Rules: light drops by one per step through non-opaque voxels, opaque voxels hold none,
+## and full sunlight keeps level 15 going straight down through air
+## Chunks whose light changed are collected for remeshing (take_changed_chunks)
+class_name LightEngine
+extends RefCounted
+
+const MAX_LEVEL: int = ChunkLight.MAX_LEVEL
+
+## Neighbor steps in BinaryGreedyMesher.Face order (opposite step = index ^ 1)
+const STEPS: Array[Vector3i] = [
+	Vector3i(1, 0, 0), Vector3i(-1, 0, 0),
+	Vector3i(0, 1, 0), Vector3i(0, -1, 0),
+	Vector3i(0, 0, 1), Vector3i(0, 0, -1)
+]
+
+## Step along which full sunlight doesn't fade
+const DOWN_STEP: int = BinaryGreedyMesher.Face.NEG_Y
+
+## Give up a pass after this many queue entries (one edit touches a few thousand at most)
+const MAX_STEPS_PER_PASS: int = 262144
+
+## Chunk manager reference (active chunks)
+var chunk_manager: ChunkManager = null
+
+## Pending work as flat records: add = (x, y, z, channel), remove = (x, y, z, channel, level)
+var _add_queue: PackedInt32Array = PackedInt32Array()
+var _remove_queue: PackedInt32Array = PackedInt32Array()
+
+## Chunks whose light changed since the last take_changed_chunks (chunk position -> true)
+var _changed_chunks: Dictionary = {}
+
+## Cursor of the last _locate (BFS steps mostly stay inside one chunk)
+## Reset by every public entry point: pooled chunks may have moved since the last call
+var _cur_chunk: Chunk = null
+var _cur_origin: Vector3i = Vector3i.ZERO
+var _cur_size_y: int = 0
+var _cur_local: Vector3i = Vector3i.ZERO
+var _cur_index: int = 0
+
+## Statistics
+var stats_chunks_stitched: int = 0
+var stats_edits: int = 0
+var stats_steps: int = 0
+
+func _init(manager: ChunkManager = null) -> void:
+	chunk_manager = manager
+
+## Light a chunk from its own voxels (thread-safe: reads the voxel data and the generator's
+## height cache). Columns are open to the sky where the voxel above the chunk lies above the
+## generated terrain; the main thread corrects borders against loaded neighbors later
+static func compute_chunk_light(voxel_data: VoxelData, generator: TerrainGenerator) -> ChunkLight:
+	var light := ChunkLight.new(voxel_data.get_chunk_volume())
+	var opaque := VoxelTypes.get_opaque_table()
+	if voxel_data.is_uniform and opaque[voxel_data.uniform_value]:
+		return light
+
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var size_y := voxel_data.chunk_size_y
+	var z_stride := size_xz * size_y
+	var emitted := VoxelTypes.get_light_table()
+	var flat := voxel_data.to_byte_array()
+
+	var start_x := voxel_data.chunk_position.x * size_xz
+	var start_z := voxel_data.chunk_position.z * size_xz
+	var above_y := ChunkHeightZones.chunk_y_to_world_y(voxel_data.chunk_position.y) + size_y
+	var sea_level := generator.get_sea_level()
+	var tile := generator.height_cache.get_tile(HeightTileCache.world_to_tile(start_x, start_z), generator)
+	var tile_offset := (start_x & (HeightTileCache.TILE_SIZE - 1)) + (start_z & (HeightTileCache.TILE_SIZE - 1)) * HeightTileCache.TILE_SIZE
+
+	# Flood queue of (index << 1 | channel), and transparent cells darker than open air
+	var queue := PackedInt32Array()
+	var dim_cells := PackedInt32Array()
+
+	# Step 1: sunlight down each column, and emitters
+	for z in range(size_xz):
+		for x in range(size_xz):
+			var level := 0
+			if above_y > tile.heights[tile_offset + x + z * HeightTileCache.TILE_SIZE]:
+				# Above the terrain: open air, or water fading from the surface down
+				level = MAX_LEVEL if above_y > sea_level else maxi(0, MAX_LEVEL - 1 - (sea_level - above_y))
+
+			for y in range(size_y - 1, -1, -1):
+				var i := x + y * size_xz + z * z_stride
+				var voxel_type: int = flat[i]
+				if opaque[voxel_type]:
+					level = 0
+				else:
+					level = maxi(0, _next_level(level, ChunkLight.CHANNEL_SKY, DOWN_STEP, voxel_type))
+					if level > 0:
+						light.set_light(ChunkLight.CHANNEL_SKY, i, level)
+					if level < MAX_LEVEL - 1:
+						dim_cells.append(i)
+				if emitted[voxel_type] > 0:
+					light.set_light(ChunkLight.CHANNEL_BLOCK, i, emitted[voxel_type])
+					queue.append((i << 1) | ChunkLight.CHANNEL_BLOCK)
+
+	# Step 2: sunlight spreads sideways into dim cells (under overhangs, into cave mouths)
+	for i in dim_cells:
+		var level := light.get_light(ChunkLight.CHANNEL_SKY, i)
+		var x := i % size_xz
+		var z := i / z_stride
+		for s in [BinaryGreedyMesher.Face.POS_X, BinaryGreedyMesher.Face.NEG_X, BinaryGreedyMesher.Face.POS_Z, BinaryGreedyMesher.Face.NEG_Z]:
+			var nx: int = x + STEPS[s].x
+			var nz: int = z + STEPS[s].z
+			if nx < 0 or nx >= size_xz or nz < 0 or nz >= size_xz:
+				continue
+			var j := i + STEPS[s].x + STEPS[s].z * z_stride
+			if light.get_light(ChunkLight.CHANNEL_SKY, j) > level + 1:
+				queue.append((j << 1) | ChunkLight.CHANNEL_SKY)
+
+	# Step 3: flood fill both channels inside the chunk
+	var head := 0
+	while head < queue.size():
+		var entry: int = queue[head]
+		head += 1
+		var i := entry >> 1
+		var channel := entry & 1
+		var level := light.get_light(channel, i)
+		if level <= 1:
+			continue
+
+		var x := i % size_xz
+		var y := (i / size_xz) % size_y
+		var z := i / z_stride
+		for s in range(6):
+			var step := STEPS[s]
+			var nx := x + step.x
+			var ny := y + step.y
+			var nz := z + step.z
+			if nx < 0 or nx >= size_xz or ny < 0 or ny >= size_y or nz < 0 or nz >= size_xz:
+				continue
+			var j := nx + ny * size_xz + nz * z_stride
+			var voxel_type: int = flat[j]
+			if opaque[voxel_type]:
+				continue
+			var next := _next_level(level, channel, s, voxel_type)
+			if light.get_light(channel, j) >= next:
+				continue
+			light.set_light(channel, j, next)
+			queue.append((j << 1) | channel)
+
+	return light
+
+## Level light reaches after one step into a non-opaque voxel
+static func _next_level(level: int, channel: int, step: int, voxel_type: int) -> int:
+	if level == MAX_LEVEL and step == DOWN_STEP and channel == ChunkLight.CHANNEL_SKY and voxel_type == VoxelTypes.Type.AIR:
+		return MAX_LEVEL
+	return level - 1
+
+## Exchange light between a newly active chunk and its loaded face neighbors (main thread)
+## Top border cells brighter than the chunk above allows are darkened first (one pair at a
+## time, so a column corrected above the chunk is seen below it); then only border cells
+## where one side would brighten the other seed the flood fill
+func on_chunk_loaded(chunk: Chunk) -> void:
+	if not chunk.light:
+		return
+
+	_cur_chunk = null
+	var above := chunk.get_neighbor(BinaryGreedyMesher.Face.POS_Y)
+	if above and above.light:
+		_seed_sky_removal(chunk, above)
+		_propagate_remove()
+	var below := chunk.get_neighbor(BinaryGreedyMesher.Face.NEG_Y)
+	if below and below.light:
+		_seed_sky_removal(below, chunk)
+		_propagate_remove()
+
+	for face in range(6):
+		var neighbor := chunk.get_neighbor(face)
+		if not neighbor or not neighbor.light:
+			continue
+		if chunk.light.is_dark() and neighbor.light.is_dark():
+			continue  # Buried on both sides
+		_seed_border(chunk, neighbor, face)
+
+	stats_chunks_stitched += 1
+	_propagate_add()
+
+## Update light after voxels changed (main thread), one remove pass and one add pass for
+## the whole batch. positions are world voxels, old_types/new_types their types before and
+## after; call after the voxel data has been written
+func on_voxels_changed(positions: Array[Vector3i], old_types: PackedByteArray, new_types: PackedByteArray) -> void:
+	_cur_chunk = null
+	for i in range(positions.size()):
+		_seed_voxel_change(positions[i], old_types[i], new_types[i])
+
+	_propagate_remove()
+	_propagate_add()
+
+## Baked light level (brighter channel) at a world position, 0 where no chunk is lit
+func get_light_at_world(world_pos: Vector3i) -> int:
+	_cur_chunk = null
+	if not _locate(world_pos.x, world_pos.y, world_pos.z):
+		return 0
+	return _cur_chunk.light.get_level(_cur_index)
+
+## Get and reset the set of chunk positions whose light changed
+func take_changed_chunks() -> Dictionary:
+	var changed := _changed_chunks
+	_changed_chunks = {}
+	return changed
+
+## Get light engine statistics
+func get_stats() -> Dictionary:
+	return {
+		"chunks_stitched": stats_chunks_stitched,
+		"edits": stats_edits,
+		"steps": stats_steps
+	}
+
+## Queue the light updates for one changed voxel
+func _seed_voxel_change(world_pos: Vector3i, old_type: int, new_type: int) -> void:
+	if not _locate(world_pos.x, world_pos.y, world_pos.z):
+		return
+
+	var opaque := VoxelTypes.get_opaque_table()
+	var emitted := VoxelTypes.get_light_table()
+	var chunk := _cur_chunk
+	var index := _cur_index
+	stats_edits += 1
+
+	# Block light: a new opaque voxel or a removed emitter darkens what its light fed
+	var old_block := chunk.light.get_light(ChunkLight.CHANNEL_BLOCK, index)
+	if old_block > 0 and (opaque[new_type] or emitted[old_type] > 0):
+		_set_light(chunk, index, ChunkLight.CHANNEL_BLOCK, 0)
+		_push_remove(world_pos, ChunkLight.CHANNEL_BLOCK, old_block)
+	if emitted[new_type] > chunk.light.get_light(ChunkLight.CHANNEL_BLOCK, index):
+		_set_light(chunk, index, ChunkLight.CHANNEL_BLOCK, emitted[new_type])
+		_push_add(world_pos, ChunkLight.CHANNEL_BLOCK)
+
+	# Sunlight: a new opaque voxel shades everything its light reached
+	var old_sky := chunk.light.get_light(ChunkLight.CHANNEL_SKY, index)
+	if opaque[new_type] and old_sky > 0:
+		_set_light(chunk, index, ChunkLight.CHANNEL_SKY, 0)
+		_push_remove(world_pos, ChunkLight.CHANNEL_SKY, old_sky)
+
+	# An opened voxel takes light from its neighbors
+	if opaque[old_type] and not opaque[new_type]:
+		for step in STEPS:
+			_push_add(world_pos + step, ChunkLight.CHANNEL_BLOCK)
+			_push_add(world_pos + step, ChunkLight.CHANNEL_SKY)
+
+## Seed the flood fill across one face shared by chunk and neighbor
+func _seed_border(chunk: Chunk, neighbor: Chunk, face: int) -> void:
+	var size_xz := VoxelData.CHUNK_SIZE_XZ
+	var size_y := chunk.voxel_data.chunk_size_y
+	var neighbor_size_y := neighbor.voxel_data.chunk_size_y
+	var origin := _get_chunk_origin(chunk)
+	var neighbor_origin := _get_chunk_origin(neighbor)
+	var opaque := VoxelTypes.get_opaque_table()
+	var vertical := face == BinaryGreedyMesher.Face.POS_Y or face == BinaryGreedyMesher.Face.NEG_Y
+	var rows := size_xz if vertical else size_y
+
+	for v in range(rows):
+		for u in range(size_xz):
+			var a: Vector3i  # Cell of the chunk
+			var b: Vector3i  # Cell of the neighbor across the face
+			match face:
+				BinaryGreedyMesher.Face.POS_X:
+					a = Vector3i(size_xz - 1, v, u); b = Vector3i(0, v, u)
+				BinaryGreedyMesher.Face.NEG_X:
+					a = Vector3i(0, v, u); b = Vector3i(size_xz - 1, v, u)
+				BinaryGreedyMesher.Face.POS_Y:
+					a = Vector3i(u, size_y - 1, v); b = Vector3i(u, 0, v)
+				BinaryGreedyMesher.Face.NEG_Y:
+					a = Vector3i(u, 0, v); b = Vector3i(u, neighbor_size_y - 1, v)
+				BinaryGreedyMesher.Face.POS_Z:
+					a = Vector3i(u, v, size_xz - 1); b = Vector3i(u, v, 0)
+				_:
+					a = Vector3i(u, v, 0); b = Vector3i(u, v, size_xz - 1)
+
+			var type_a := chunk.voxel_data.get_voxel(a)
+			var type_b := neighbor.voxel_data.get_voxel(b)
+			if opaque[type_a] and opaque[type_b]:
+				continue
+			var index_a := chunk.voxel_data.get_index(a)
+			var index_b := neighbor.voxel_data.get_index(b)
+
+			for channel in [ChunkLight.CHANNEL_BLOCK, ChunkLight.CHANNEL_SKY]:
+				var level_a := chunk.light.get_light(channel, index_a)
+				var level_b := neighbor.light.get_light(channel, index_b)
+				if not opaque[type_b] and _next_level(level_a, channel, face, type_b) > level_b:
+					_push_add(origin + a, channel)
+				elif not opaque[type_a] and _next_level(level_b, channel, face ^ 1, type_a) > level_a:
+					_push_add(neighbor_origin + b, channel)
+
+## Seed the removal of sunlight in the lower chunk's top cells that neither the cell above
+## nor another neighbor can feed: compute_chunk_light opens columns by the generator's
+## heights, which don't know about blocks placed in the chunk above
+func _seed_sky_removal(lower: Chunk, upper: Chunk) -> void:
+	var top := lower.voxel_data.chunk_size_y - 1
+	var origin := _get_chunk_origin(lower)
+
+	for z in range(VoxelData.CHUNK_SIZE_XZ):
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			var a := Vector3i(x, top, z)
+			var index := lower.voxel_data.get_index(a)
+			var level := lower.light.get_light(ChunkLight.CHANNEL_SKY, index)
+			if level == 0:
+				continue
+
+			var b := Vector3i(x, 0, z)
+			var level_above := upper.light.get_light(ChunkLight.CHANNEL_SKY, upper.voxel_data.get_index(b))
+			if _next_level(level_above, ChunkLight.CHANNEL_SKY, DOWN_STEP, lower.voxel_data.get_voxel(a)) >= level:
+				continue
+			if _is_sky_fed_from_side(origin + a, level):
+				continue
+
+			_set_light(lower, index, ChunkLight.CHANNEL_SKY, 0)
+			_push_remove(origin + a, ChunkLight.CHANNEL_SKY, level)
+
+## Check if a neighbor other than the one above is bright enough to light a cell with sunlight
+## (sideways and upward steps always fade, so it needs a higher level)
+func _is_sky_fed_from_side(world_pos: Vector3i, level: int) -> bool:
+	for s in range(6):
+		if s == BinaryGreedyMesher.Face.POS_Y:
+			continue
+		var step := STEPS[s]
+		if _locate(world_pos.x + step.x, world_pos.y + step.y, world_pos.z + step.z) \
+				and _cur_chunk.light.get_light(ChunkLight.CHANNEL_SKY, _cur_index) > level:
+			return true
+	return false
+
+## Drain the add queue: every entry spreads its current level to darker neighbors
+func _propagate_add() -> void:
+	var opaque := VoxelTypes.get_opaque_table()
+	var head := 0
+	while head < _add_queue.size():
+		var x: int = _add_queue[head]
+		var y: int = _add_queue[head + 1]
+		var z: int = _add_queue[head + 2]
+		var channel: int = _add_queue[head + 3]
+		head += 4
+		if head > MAX_STEPS_PER_PASS * 4:
+			push_warning("[LightEngine] Add pass stopped after %d steps" % MAX_STEPS_PER_PASS)
+			break
+
+		if not _locate(x, y, z):
+			continue
+		var level := _cur_chunk.light.get_light(channel, _cur_index)
+		if level <= 1:
+			continue
+
+		for s in range(6):
+			var step := STEPS[s]
+			if not _locate(x + step.x, y + step.y, z + step.z):
+				continue
+			var voxel_type := _cur_chunk.voxel_data.get_voxel(_cur_local)
+			if opaque[voxel_type]:
+				continue
+			var next := _next_level(level, channel, s, voxel_type)
+			if _cur_chunk.light.get_light(channel, _cur_index) >= next:
+				continue
+			_set_light(_cur_chunk, _cur_index, channel, next)
+			_add_queue.append(x + step.x)
+			_add_queue.append(y + step.y)
+			_add_queue.append(z + step.z)
+			_add_queue.append(channel)
+
+	stats_steps += head / 4
+	_add_queue.clear()
+
+## Drain the remove queue: neighbors lit by a removed level go dark (and spread the removal),
+## brighter neighbors are re-queued to refill the darkened area in _propagate_add
+func _propagate_remove() -> void:
+	var emitted := VoxelTypes.get_light_table()
+	var head := 0
+	while head < _remove_queue.size():
+		var x: int = _remove_queue[head]
+		var y: int = _remove_queue[head + 1]
+		var z: int = _remove_queue[head + 2]
+		var channel: int = _remove_queue[head + 3]
+		var level: int = _remove_queue[head + 4]
+		head += 5
+		if head > MAX_STEPS_PER_PASS * 5:
+			push_warning("[LightEngine] Remove pass stopped after %d steps" % MAX_STEPS_PER_PASS)
+			break
+
+		for s in range(6):
+			var step := STEPS[s]
+			var neighbor_pos := Vector3i(x + step.x, y + step.y, z + step.z)
+			if not _locate(neighbor_pos.x, neighbor_pos.y, neighbor_pos.z):
+				continue
+			var neighbor_level := _cur_chunk.light.get_light(channel, _cur_index)
+			if neighbor_level == 0:
+				continue
+
+			var fed_by_removed := neighbor_level < level or (
+				channel == ChunkLight.CHANNEL_SKY and s == DOWN_STEP and level == MAX_LEVEL and neighbor_level == MAX_LEVEL)
+			if not fed_by_removed:
+				_push_add(neighbor_pos, channel)
+				continue
+
+			_set_light(_cur_chunk, _cur_index, channel, 0)
+			_push_remove(neighbor_pos, channel, neighbor_level)
+
+			# Emitters inside the darkened area relight themselves
+			if channel == ChunkLight.CHANNEL_BLOCK:
+				var emission: int = emitted[_cur_chunk.voxel_data.get_voxel(_cur_local)]
+				if emission > 0:
+					_set_light(_cur_chunk, _cur_index, channel, emission)
+					_push_add(neighbor_pos, channel)
+
+	stats_steps += head / 5
+	_remove_queue.clear()
+
+func _push_add(world_pos: Vector3i, channel: int) -> void:
+	_add_queue.append(world_pos.x)
+	_add_queue.append(world_pos.y)
+	_add_queue.append(world_pos.z)
+	_add_queue.append(channel)
+
+func _push_remove(world_pos: Vector3i, channel: int, level: int) -> void:
+	_remove_queue.append(world_pos.x)
+	_remove_queue.append(world_pos.y)
+	_remove_queue.append(world_pos.z)
+	_remove_queue.append(channel)
+	_remove_queue.append(level)
+
+## Write a level and remember the chunk for remeshing
+func _set_light(chunk: Chunk, index: int, channel: int, level: int) -> void:
+	chunk.light.set_light(channel, index, level)
+	_changed_chunks[chunk.position] = true
+	_mark_light_slices(chunk, index)
+
+## Mark the slices whose faces a relit cell lights (partial remeshing): the slices around it
+## in its chunk, and the border slice of the face neighbor whose faces look into the cell
+## (that neighbor is remeshed too)
+func _mark_light_slices(chunk: Chunk, index: int) -> void:
+	var local := chunk.voxel_data.get_position_from_index(index)
+	chunk.mark_slices_dirty(local)
+
+	var size_y := chunk.voxel_data.chunk_size_y
+	var last := Vector3i(VoxelData.CHUNK_SIZE_XZ - 1, size_y - 1, VoxelData.CHUNK_SIZE_XZ - 1)
+	for axis in range(3):
+		var face: int
+		if local[axis] == last[axis]:
+			face = axis * 2  # Positive face
+		elif local[axis] == 0:
+			face = axis * 2 + 1  # Negative face
+		else:
+			continue
+		var neighbor := chunk.get_neighbor(face)
+		if not neighbor:
+			continue
+
+		# The cell in the neighbor's coordinates, one step outside its border
+		var neighbor_local := local
+		if face & 1:
+			neighbor_local[axis] = VoxelData.CHUNK_SIZE_XZ if axis != 1 else neighbor.voxel_data.chunk_size_y
+		else:
+			neighbor_local[axis] = -1
+		neighbor.mark_slices_dirty(neighbor_local)
+		# Its own light may be unchanged (opaque wall facing the cell), but its faces aren't
+		_changed_chunks[neighbor.position] = true
+
+## Point the cursor at the lit chunk holding a world voxel (false if none is active)
+func _locate(x: int, y: int, z: int) -> bool:
+	if _cur_chunk:
+		var lx := x - _cur_origin.x
+		var ly := y - _cur_origin.y
+		var lz := z - _cur_origin.z
+		if lx >= 0 and lx < VoxelData.CHUNK_SIZE_XZ and ly >= 0 and ly < _cur_size_y and lz >= 0 and lz < VoxelData.CHUNK_SIZE_XZ:
+			_cur_local = Vector3i(lx, ly, lz)
+			_cur_index = lx + ly * VoxelData.CHUNK_SIZE_XZ + lz * VoxelData.CHUNK_SIZE_XZ * _cur_size_y
+			return true
+
+	var chunk: Chunk = chunk_manager.active_chunks.get_chunk(ChunkHeightZones.world_to_chunk_position(Vector3(x, y, z)))
+	if not chunk or not chunk.light or chunk.state == Chunk.State.UNLOADING:
+		_cur_chunk = null
+		return false
+
+	_cur_chunk = chunk
+	_cur_origin = _get_chunk_origin(chunk)
+	_cur_size_y = chunk.voxel_data.chunk_size_y
+	_cur_local = Vector3i(x, y, z) - _cur_origin
+	_cur_index = chunk.voxel_data.get_index(_cur_local)
+	return true
+
+static func _get_chunk_origin(chunk: Chunk) -> Vector3i:
+	return Vector3i(
+		chunk.position.x * VoxelData.CHUNK_SIZE_XZ,
+		ChunkHeightZones.chunk_y_to_world_y(chunk.position.y),
+		chunk.position.z * VoxelData.CHUNK_SIZE_XZ
+	)
@@ -0,0 +1,240 @@
+## LodManager - Distant terrain beyond the full-resolution chunks, from downsampled voxel mips
+## The ring outside render_distance is covered by LodTiles picked from a quadtree over 8x
+## tiles (one region footprint each): a tile splits into four finer tiles while the player
+## is closer than the split distance of its level, so detail halves with each distance band
+##
+## Level bands (render distance R in blocks): 2x cells up to 2R, 4x up to 4R, 8x beyond,
+## out to lod_distance. 2x tiles leave out their chunk columns inside the loaded chunk
+## diamond (LodTile.covered_mask), and are skipped when all of them are
+##
+## Tiles are built on the ChunkThreadPool (BUILD_LOD jobs) and swapped in when finished;
+## tiles that left the selection stay visible until every queued replacement is built,
+## so level changes never open holes
+class_name LodManager
+extends RefCounted
+
+## Re-select tiles after the player moves this far (blocks)
+const UPDATE_THRESHOLD: float = 16.0
+
+## Chunk manager reference (culling slots, job priorities, configuration)
+var chunk_manager: ChunkManager = null
+
+## Parent node of the tile mesh instances
+var root: Node3D = null
+
+## Built tiles (LodTile.make_key -> LodTile), including tiles without geometry
+var tiles: Dictionary = {}
+
+## Queued tile jobs (LodTile.make_key -> ChunkThreadPool.ChunkJob, the tile is job.lod_tile)
+var pending: Dictionary = {}
+
+## Tiles that left the selection, freed once no replacement is pending
+var _retired: Array[LodTile] = []
+
+## Player position and chunk at the last selection
+var _last_update_position: Vector3 = Vector3.INF
+var _last_player_chunk: Vector3i = Vector3i(0x7FFFFFFF, 0, 0)
+
+## Statistics
+var stats_tiles_built: int = 0
+var stats_vertices: int = 0
+
+func _init(manager: ChunkManager = null) -> void:
+	chunk_manager = manager
+	root = Node3D.new()
+	root.name = "LodTiles"
+	if chunk_manager:
+		chunk_manager.add_child(root)
+	print("[LodManager] Initialized (levels %d-%d)" % [TerrainMip.MIN_LEVEL, TerrainMip.MAX_LEVEL])
+
+## Re-select tiles around the player (cheap no-op until the player moves UPDATE_THRESHOLD
+## or into another chunk, which moves the loaded chunk diamond)
+func update(player_position: Vector3) -> void:
+	if not chunk_manager.thread_pool or not chunk_manager.terrain_generator or not chunk_manager.mesh_builder:
+		return
+	var player_chunk := chunk_manager.world_to_chunk_position(player_position)
+	if _last_update_position.distance_to(player_position) < UPDATE_THRESHOLD and player_chunk == _last_player_chunk:
+		return
+	_last_update_position = player_position
+	_last_player_chunk = player_chunk
+
+	# Wanted tiles (key -> covered chunk mask)
+	var wanted: Dictionary = {}
+	_select_tiles(player_position, wanted)
+
+	# Drop queued tiles that are no longer wanted (or no longer cover the right columns)
+	for key in pending.keys():
+		if wanted.get(key, -1) != pending[key].lod_tile.covered_mask:
+			chunk_manager.thread_pool.cancel_job(pending[key])
+			pending.erase(key)
+
+	# Retire built tiles that are no longer wanted
+	for key in tiles.keys():
+		if wanted.get(key, -1) != tiles[key].covered_mask:
+			_retired.append(tiles[key])
+			tiles.erase(key)
+
+	# Queue the missing tiles
+	for key in wanted:
+		if not tiles.has(key) and not pending.has(key):
+			var tile := LodTile.new(key.y, Vector2i(key.x, key.z))
+			tile.covered_mask = wanted[key]
+			pending[key] = chunk_manager.thread_pool.queue_lod_job(
+				tile, chunk_manager.terrain_generator, chunk_manager.mesh_builder, _get_tile_priority(tile))
+
+	if pending.is_empty():
+		_free_retired()
+
+## Handle a finished BUILD_LOD job (call on main thread)
+func on_tile_built(job) -> void:
+	var key: Vector3i = job.chunk_pos
+	if pending.get(key) != job:
+		return
+	pending.erase(key)
+
+	var tile: LodTile = job.lod_tile
+	if job.error:
+		push_error("[LodManager] LOD error for tile %s: %s" % [key, job.error])
+	elif not job.result.is_empty():
+		var mesh_data: Dictionary = job.result
+		var cell := float(tile.get_cell_size())
+		var origin := tile.get_world_origin()
+		tile.mesh_instance = chunk_manager.mesh_builder.create_mesh_instance_from_data(mesh_data)
+		tile.mesh_instance.position = Vector3(origin.x, tile.y_min_cell * cell, origin.y)
+		tile.mesh_instance.scale = Vector3.ONE * cell
+		tile.mesh_instance.cast_shadow = GeometryInstance3D.SHADOW_CASTING_SETTING_OFF
+		root.add_child(tile.mesh_instance)
+		tile.cull_slot = chunk_manager._add_cull_slot(tile, tile.get_aabb())
+		tile.vertex_count = mesh_data.vertices
+		stats_vertices += tile.vertex_count
+		stats_tiles_built += 1
+
+	tiles[key] = tile
+	if pending.is_empty():
+		_free_retired()
+
+## Re-score a queued LOD job; negative if the tile is no longer wanted
+func score_job(job) -> float:
+	if pending.get(job.chunk_pos) != job:
+		return -1.0
+	return _get_tile_priority(job.lod_tile)
+
+## Release every tile
+func clear() -> void:
+	for job in pending.values():
+		if chunk_manager.thread_pool:
+			chunk_manager.thread_pool.cancel_job(job)
+	pending.clear()
+	for tile in tiles.values():
+		_release_tile(tile)
+	tiles.clear()
+	_free_retired()
+	_last_update_position = Vector3.INF
+	_last_player_chunk = Vector3i(0x7FFFFFFF, 0, 0)
+
+## Get LOD statistics
+func get_stats() -> Dictionary:
+	var visible_tiles := 0
+	for tile in tiles.values():
+		if tile.mesh_instance:
+			visible_tiles += 1
+	return {
+		"tiles": tiles.size(),
+		"mesh_tiles": visible_tiles,
+		"pending_tiles": pending.size(),
+		"retired_tiles": _retired.size(),
+		"tiles_built": stats_tiles_built,
+		"vertices": stats_vertices
+	}
+
+## Walk the tile quadtree from the coarsest level over the lod_distance disc
+func _select_tiles(player_position: Vector3, wanted: Dictionary) -> void:
+	var center := Vector2(player_position.x, player_position.z)
+	var radius := float(chunk_manager.lod_distance * VoxelData.CHUNK_SIZE_XZ)
+	var top_size := LodTile.get_tile_size(TerrainMip.MAX_LEVEL)
+	var covered_radius := _get_covered_chunk_radius(player_position)
+	var player_chunk := chunk_manager.world_to_chunk_position(player_position)
+
+	var min_tile := Vector2i(floori((center.x - radius) / top_size), floori((center.y - radius) / top_size))
+	var max_tile := Vector2i(floori((center.x + radius) / top_size), floori((center.y + radius) / top_size))
+	for tz in range(min_tile.y, max_tile.y + 1):
+		for tx in range(min_tile.x, max_tile.x + 1):
+			_select_tile(TerrainMip.MAX_LEVEL, Vector2i(tx, tz), center, radius, covered_radius, player_chunk, wanted)
+
+## Select one tile, or recurse into its four children if the player is too close for its level
+func _select_tile(level: int, tile_pos: Vector2i, center: Vector2, radius: float,
+				  covered_radius: int, player_chunk: Vector3i, wanted: Dictionary) -> void:
+	var size := LodTile.get_tile_size(level)
+	var distance := _distance_to_tile(center, tile_pos, size)
+	if distance > radius:
+		return
+
+	var split_distance := float(chunk_manager.render_distance * VoxelData.CHUNK_SIZE_XZ * (1 << (level - 1)))
+	if level > TerrainMip.MIN_LEVEL and distance < split_distance:
+		for dz in range(2):
+			for dx in range(2):
+				_select_tile(level - 1, tile_pos * 2 + Vector2i(dx, dz), center, radius, covered_radius, player_chunk, wanted)
+		return
+
+	var covered_mask := 0
+	if level == TerrainMip.MIN_LEVEL:
+		var chunks_across := LodTile.get_chunks_across(level)
+		covered_mask = _get_covered_mask(tile_pos, covered_radius, player_chunk)
+		if covered_mask == (1 << (chunks_across * chunks_across)) - 1:
+			return
+
+	wanted[LodTile.make_key(level, tile_pos)] = covered_mask
+
+## Horizontal distance from a point to a tile's square (0 inside)
+func _distance_to_tile(center: Vector2, tile_pos: Vector2i, size: int) -> float:
+	var tile_min := Vector2(tile_pos * size)
+	var nearest := center.clamp(tile_min, tile_min + Vector2(size, size))
+	return center.distance_to(nearest)
+
+## Chunk-space Manhattan radius the full-resolution chunks cover at terrain height
+## (ChunkManager loads |dx| + |dy| + |dz| <= render_distance within vertical_render_distance)
+## Returns -1 if the terrain is outside the vertical range
+func _get_covered_chunk_radius(player_position: Vector3) -> int:
+	var player_chunk_y := chunk_manager.world_to_chunk_position(player_position).y
+	var surface_chunk_y := ChunkHeightZones.world_y_to_chunk_y(chunk_manager.terrain_generator.base_height)
+	var dy := absi(surface_chunk_y - player_chunk_y)
+	if dy > chunk_manager.vertical_render_distance:
+		return -1
+	return chunk_manager.render_distance - dy
+
+## Chunk columns of a finest-level tile within the loaded chunk diamond (LodTile.covered_mask)
+func _get_covered_mask(tile_pos: Vector2i, covered_radius: int, player_chunk: Vector3i) -> int:
+	if covered_radius < 0:
+		return 0
+	var chunks_across := LodTile.get_chunks_across(TerrainMip.MIN_LEVEL)
+	var first := tile_pos * chunks_across
+	var mask := 0
+	for dz in range(chunks_across):
+		for dx in range(chunks_across):
+			if absi(first.x + dx - player_chunk.x) + absi(first.y + dz - player_chunk.z) <= covered_radius:
+				mask |= 1 << (dx + dz * chunks_across)
+	return mask
+
+## Job priority of a tile (same inverse-distance scale as chunk jobs, so near chunks win)
+func _get_tile_priority(tile: LodTile) -> float:
+	var size := float(LodTile.get_tile_size(tile.level))
+	var origin := tile.get_world_origin()
+	var center := Vector3(origin.x + size * 0.5, chunk_manager.tracked_position.y, origin.y + size * 0.5)
+	return chunk_manager._calculate_job_priority(center)
+
+## Free tiles that were kept visible while their replacements were built
+func _free_retired() -> void:
+	for tile in _retired:
+		_release_tile(tile)
+	_retired.clear()
+
+## Remove a tile's mesh instance and culling slot
+func _release_tile(tile: LodTile) -> void:
+	if tile.cull_slot >= 0:
+		chunk_manager._remove_cull_slot(tile.cull_slot)
+		tile.cull_slot = -1
+	if tile.mesh_instance:
+		stats_vertices -= tile.vertex_count
+		root.remove_child(tile.mesh_instance)
+		tile.mesh_instance.queue_free()
+		tile.mesh_instance = null
@@ -3,7 +3,9 @@
 ## 1. Simple raycast-based occlusion (fast, less accurate)
 ## 2. Graph-based flood-fill visibility (more accurate, cached)
 ##
-## Inspired by Sodium mod's occlusion culling approach
+## Inspired by Sodium mod's occlusion culling approach: the flood fill only passes
+## through a chunk from the face it entered to faces joined by open cells inside it
+## (Chunk.face_connectivity, computed by the mesher), and never turns back toward the camera
 class_name OcclusionCuller
 extends RefCounted
 
@@ -20,9 +22,20 @@ var mode: Mode = Mode.FLOOD_FILL
 ## Chunk manager reference
 var chunk_manager: ChunkManager = null
 
-## Visibility graph: chunk_pos -> array of visible neighbor positions
-## This represents which chunks can "see" each other (have exposed faces)
-var visibility_graph: Dictionary = {}
+## Step direction per BinaryGreedyMesher.Face (leaving a chunk through that face)
+const FACE_OFFSETS: Array[Vector3i] = [
+	Vector3i(1, 0, 0), Vector3i(-1, 0, 0), Vector3i(0, 1, 0),
+	Vector3i(0, -1, 0), Vector3i(0, 0, 1), Vector3i(0, 0, -1)
+]
+
+## The same steps as ChunkMap key differences
+const FACE_KEY_STEPS: PackedInt64Array = [
+	ChunkMap.KEY_STEP_X, -ChunkMap.KEY_STEP_X, ChunkMap.KEY_STEP_Y,
+	-ChunkMap.KEY_STEP_Y, ChunkMap.KEY_STEP_Z, -ChunkMap.KEY_STEP_Z
+]
+
+## All six faces as a mask
+const ALL_FACES: int = 0x3F
 
 ## Currently visible chunks (updated each frame)
 var visible_chunks: Dictionary = {}  # Vector3i -> true
@@ -34,6 +47,7 @@ var last_camera_chunk_pos: Vector3i = Vector3i(999999, 999999, 999999)
 var stats_visible_chunks: int = 0
 var stats_occluded_chunks: int = 0
 var stats_graph_updates: int = 0
+var stats_chunks_traversed: int = 0
 
 ## Configuration
 var max_visibility_distance: int = 16  # Maximum chunks to check
@@ -49,12 +63,12 @@ func _init(manager: ChunkManager = null):
 	print("[OcclusionCuller] Initialized with mode: %s" % Mode.keys()[mode])
 
 ## Update visibility for all chunks based on camera position
-func update_visibility(camera_position: Vector3, active_chunks: Dictionary) -> void:
+func update_visibility(camera_position: Vector3, active_chunks: ChunkMap) -> void:
 	if mode == Mode.DISABLED:
 		# Mark all chunks visible
 		visible_chunks.clear()
-		for chunk_pos in active_chunks.keys():
-			visible_chunks[chunk_pos] = true
+		for chunk in active_chunks.get_chunks():
+			visible_chunks[chunk.position] = true
 		stats_visible_chunks = visible_chunks.size()
 		stats_occluded_chunks = 0
 		return
@@ -68,10 +82,14 @@ func update_visibility(camera_position: Vector3, active_chunks: Dictionary) -> v
 	if mode == Mode.RAYCAST:
 		_update_visibility_raycast(camera_position, active_chunks)
 	elif mode == Mode.FLOOD_FILL:
-		# Only rebuild if camera moved or graph is dirty
-		if camera_moved or graph_dirty or not enable_caching:
+		# Refill when the camera changes chunk; chunk changes are batched every rebuild_graph_interval frames
+		var graph_refresh := graph_dirty and frame_counter % rebuild_graph_interval == 0
+		if camera_moved or graph_refresh or not enable_caching:
 			_update_visibility_flood_fill(camera_chunk_pos, active_chunks)
 			last_camera_chunk_pos = camera_chunk_pos
+			if graph_dirty:
+				graph_dirty = false
+				stats_graph_updates += 1
 		# Else use cached visibility
 
 	# Update stats
@@ -82,23 +100,21 @@ func update_visibility(camera_position: Vector3, active_chunks: Dictionary) -> v
 
 ## Simple raycast-based occlusion culling
 ## Fast but less accurate - checks if a ray from camera to chunk center hits another chunk
-func _update_visibility_raycast(camera_position: Vector3, active_chunks: Dictionary) -> void:
+func _update_visibility_raycast(camera_position: Vector3, active_chunks: ChunkMap) -> void:
 	visible_chunks.clear()
 
-	for chunk_pos in active_chunks.keys():
-		var chunk: Chunk = active_chunks[chunk_pos]
-		if not chunk:
-			continue
+	for chunk in active_chunks.get_chunks():
+		var chunk_pos := chunk.position
 
-		# Get chunk center in world space
-		var chunk_center := chunk.get_world_position() + Vector3.ONE * (VoxelData.CHUNK_SIZE * 0.5)
+		# Get chunk center in world space (chunk heights vary by zone)
+		var chunk_center := chunk.get_aabb().get_center()
 
 		# Check if chunk is occluded by raycasting
 		if _is_chunk_visible_raycast(camera_position, chunk_center, chunk_pos, active_chunks):
 			visible_chunks[chunk_pos] = true
 
 ## Check if chunk is visible via raycast (simple approach)
-func _is_chunk_visible_raycast(from: Vector3, to: Vector3, target_chunk_pos: Vector3i, active_chunks: Dictionary) -> bool:
+func _is_chunk_visible_raycast(from: Vector3, to: Vector3, target_chunk_pos: Vector3i, active_chunks: ChunkMap) -> bool:
 	# Calculate ray direction
 	var direction := (to - from).normalized()
 	var max_distance := from.distance_to(to)
@@ -116,11 +132,10 @@ func _is_chunk_visible_raycast(from: Vector3, to: Vector3, target_chunk_pos: Vec
 			continue
 
 		# Check if there's a chunk here that could block visibility
-		if test_chunk_pos in active_chunks:
-			var blocking_chunk: Chunk = active_chunks[test_chunk_pos]
-
+		var blocking_chunk := active_chunks.get_chunk(test_chunk_pos)
+		if blocking_chunk:
 			# If blocking chunk is not empty and not fully transparent, it blocks visibility
-			if blocking_chunk and not blocking_chunk.is_empty():
+			if not blocking_chunk.is_empty():
 				# Additional check: is the ray actually inside this blocking chunk?
 				var blocking_aabb := blocking_chunk.get_aabb()
 				if blocking_aabb.has_point(test_pos):
@@ -129,143 +144,76 @@ func _is_chunk_visible_raycast(from: Vector3, to: Vector3, target_chunk_pos: Vec
 	return true  # Visible
 
 ## Graph-based flood-fill visibility (Sodium-style approach)
-## More accurate - builds connectivity graph and flood-fills from camera position
-func _update_visibility_flood_fill(camera_chunk_pos: Vector3i, active_chunks: Dictionary) -> void:
+## Breadth-first from the camera chunk. Each chunk records the faces it was entered
+## through and the directions travelled to reach it; it can be left through a face only if
+## that face is connected to an entry face inside the chunk, and the step doesn't head back
+## toward the camera (no direction whose opposite was already travelled)
+## Positions without an active chunk are empty air and connect every face
+func _update_visibility_flood_fill(camera_chunk_pos: Vector3i, active_chunks: ChunkMap) -> void:
 	visible_chunks.clear()
 
-	# Rebuild visibility graph if dirty (only periodically for performance)
-	if graph_dirty and (frame_counter % rebuild_graph_interval == 0):
-		_rebuild_visibility_graph(active_chunks)
-		graph_dirty = false
-		stats_graph_updates += 1
-
-	# Flood-fill from camera position to find visible chunks
-	var open_set: Array[Vector3i] = [camera_chunk_pos]
-	var closed_set: Dictionary = {}  # Vector3i -> true
+	# Packed chunk key (ChunkMap.pack_key) -> entry faces | (travelled directions << 6),
+	# merged within a BFS level; neighbor keys are one addition away
+	var camera_key := ChunkMap.pack_key(camera_chunk_pos)
+	var entry_state: Dictionary = {camera_key: ALL_FACES}
+	var visited: Dictionary = {}
+	var queue := PackedInt64Array([camera_key])
+	var head := 0
 
-	# Camera's chunk is always visible
-	visible_chunks[camera_chunk_pos] = true
+	while head < queue.size():
+		var current_key: int = queue[head]
+		head += 1
 
-	while not open_set.is_empty():
-		var current_pos: Vector3i = open_set.pop_front()
-
-		# Skip if already processed
-		if current_pos in closed_set:
-			continue
-
-		closed_set[current_pos] = true
-
-		# Mark as visible
+		var current_pos := ChunkMap.unpack_key(current_key)
+		visited[current_key] = true
 		visible_chunks[current_pos] = true
 
-		# Get neighbors that this chunk can see
-		var visible_neighbors := _get_visible_neighbors(current_pos, active_chunks)
-
-		# Add unprocessed neighbors to open set
-		for neighbor_pos in visible_neighbors:
-			if neighbor_pos not in closed_set and neighbor_pos not in open_set:
-				# Distance check to limit propagation
-				var distance := _manhattan_distance(camera_chunk_pos, neighbor_pos)
-				if distance <= max_visibility_distance:
-					open_set.append(neighbor_pos)
-
-## Get neighbors that can be seen from a chunk position
-## A neighbor is visible if there's an exposed face between them (not fully solid border)
-func _get_visible_neighbors(chunk_pos: Vector3i, active_chunks: Dictionary) -> Array[Vector3i]:
-	var result: Array[Vector3i] = []
-
-	# Check if we have cached visibility data
-	if chunk_pos in visibility_graph:
-		return visibility_graph[chunk_pos]
-
-	# If not in graph, check all 6 neighbors
-	var neighbor_offsets := [
-		Vector3i(1, 0, 0),   # East
-		Vector3i(-1, 0, 0),  # West
-		Vector3i(0, 1, 0),   # Up
-		Vector3i(0, -1, 0),  # Down
-		Vector3i(0, 0, 1),   # North
-		Vector3i(0, 0, -1)   # South
-	]
-
-	for offset in neighbor_offsets:
-		var neighbor_pos: Vector3i = chunk_pos + offset
-
-		# Check if neighbor exists and is active
-		if neighbor_pos in active_chunks:
-			# Assume visibility if either chunk is not full (has exposed faces)
-			var current_chunk: Chunk = active_chunks.get(chunk_pos)
-			var neighbor_chunk: Chunk = active_chunks.get(neighbor_pos)
-
-			if current_chunk and neighbor_chunk:
-				# If current chunk is empty (all air), skip it
-				if current_chunk.is_empty():
-					continue
-
-				# If neighbor is empty (all air), we can see through
-				if neighbor_chunk.is_empty():
-					result.append(neighbor_pos)
-					continue
-
-				# If both chunks exist and neither is full, assume visibility through the shared face
-				if not current_chunk.is_full() or not neighbor_chunk.is_full():
-					result.append(neighbor_pos)
-
-	return result
-
-## Rebuild visibility graph for all active chunks
-## This is an expensive operation, so we cache results and only rebuild when needed
-func _rebuild_visibility_graph(active_chunks: Dictionary) -> void:
-	visibility_graph.clear()
-
-	# Build graph for all active chunks
-	for chunk_pos in active_chunks.keys():
-		var chunk: Chunk = active_chunks[chunk_pos]
-		if not chunk or chunk.is_empty():
-			continue
-
-		# Calculate visible neighbors
-		var visible_neighbors := _calculate_visible_neighbors(chunk_pos, chunk, active_chunks)
-		visibility_graph[chunk_pos] = visible_neighbors
-
-## Calculate which neighbors are visible from a chunk
-## Checks if there are exposed faces on the border between chunks
-func _calculate_visible_neighbors(chunk_pos: Vector3i, chunk: Chunk, active_chunks: Dictionary) -> Array[Vector3i]:
-	var result: Array[Vector3i] = []
-
-	# Define neighbor directions
-	var directions := {
-		"east": Vector3i(1, 0, 0),
-		"west": Vector3i(-1, 0, 0),
-		"up": Vector3i(0, 1, 0),
-		"down": Vector3i(0, -1, 0),
-		"north": Vector3i(0, 0, 1),
-		"south": Vector3i(0, 0, -1)
-	}
-
-	for direction_name in directions.keys():
-		var offset: Vector3i = directions[direction_name]
-		var neighbor_pos := chunk_pos + offset
-
-		# Check if neighbor exists
-		if neighbor_pos not in active_chunks:
-			# No neighbor = edge of loaded chunks = visible
-			result.append(neighbor_pos)
-			continue
-
-		var neighbor: Chunk = active_chunks[neighbor_pos]
-
-		# If neighbor is empty (all air), we can see through it
-		if neighbor and neighbor.is_empty():
-			result.append(neighbor_pos)
-			continue
-
-		# Check if there are exposed faces on the boundary
-		# For simplicity, we assume visibility if either chunk is not completely full
-		if not chunk.is_full() or (neighbor and not neighbor.is_full()):
-			result.append(neighbor_pos)
-
-	return result
+		var state: int = entry_state[current_key]
+		var entry_faces := state & ALL_FACES
+		var travelled := state >> 6
+
+		# Faces reachable from any entry face through this chunk's open cells
+		var exit_faces := ALL_FACES
+		var chunk := active_chunks.get_chunk_by_key(current_key)
+		if chunk and current_key != camera_key:
+			exit_faces = _get_exit_faces(chunk.face_connectivity, entry_faces)
+
+		for face in range(6):
+			if exit_faces & (1 << face) == 0:
+				continue
+			# Never step opposite to a direction already travelled (back toward the camera)
+			var opposite := face ^ 1
+			if travelled & (1 << opposite):
+				continue
+
+			if _manhattan_distance(camera_chunk_pos, current_pos + FACE_OFFSETS[face]) > max_visibility_distance:
+				continue
+
+			# Entering the neighbor through its opposite face
+			var neighbor_key: int = current_key + FACE_KEY_STEPS[face]
+			var neighbor_state := (1 << opposite) | ((travelled | (1 << face)) << 6)
+			if entry_state.has(neighbor_key):
+				if visited.has(neighbor_key):
+					continue  # Already processed (earlier BFS level)
+				entry_state[neighbor_key] = entry_state[neighbor_key] | neighbor_state
+			else:
+				entry_state[neighbor_key] = neighbor_state
+				queue.append(neighbor_key)
+
+	stats_chunks_traversed = queue.size()
+
+## Mask of faces a chunk can be left through, given the faces it was entered through
+func _get_exit_faces(connectivity: int, entry_faces: int) -> int:
+	if connectivity == BinaryGreedyMesher.CONNECTIVITY_ALL:
+		return ALL_FACES
+	if connectivity == BinaryGreedyMesher.CONNECTIVITY_NONE:
+		return 0
+
+	var exits := 0
+	for face in range(6):
+		if entry_faces & (1 << face):
+			exits |= BinaryGreedyMesher.connected_faces(connectivity, face)
+	return exits
 
 ## Check if a chunk is visible (according to current visibility data)
 func is_chunk_visible(chunk_pos: Vector3i) -> bool:
@@ -284,7 +232,7 @@ func get_stats() -> Dictionary:
 		"occluded_chunks": stats_occluded_chunks,
 		"occlusion_rate": (float(stats_occluded_chunks) / max(stats_visible_chunks + stats_occluded_chunks, 1)) * 100.0,
 		"graph_updates": stats_graph_updates,
-		"graph_size": visibility_graph.size()
+		"chunks_traversed": stats_chunks_traversed
 	}
 
 ## Print debug stats
@@ -296,7 +244,7 @@ func print_stats() -> void:
 	print("  Occluded chunks: %d" % stats.occluded_chunks)
 	print("  Occlusion rate: %.1f%%" % stats.occlusion_rate)
 	print("  Graph updates: %d" % stats.graph_updates)
-	print("  Graph size: %d entries" % stats.graph_size)
+	print("  Chunks traversed: %d" % stats.chunks_traversed)
 
 ## Set culling mode
 func set_mode(new_mode: Mode) -> void:
@@ -306,13 +254,9 @@ func set_mode(new_mode: Mode) -> void:
 		visible_chunks.clear()
 		print("[OcclusionCuller] Mode changed to: %s" % Mode.keys()[mode])
 
-## Convert world position to chunk position
+## Convert world position to chunk position (chunk heights vary by zone)
 func _world_to_chunk_position(world_pos: Vector3) -> Vector3i:
-	return Vector3i(
-		floori(world_pos.x / VoxelData.CHUNK_SIZE),
-		floori(world_pos.y / VoxelData.CHUNK_SIZE),
-		floori(world_pos.z / VoxelData.CHUNK_SIZE)
-	)
+	return ChunkHeightZones.world_to_chunk_position(world_pos)
 
 ## Calculate Manhattan distance between two chunk positions
 func _manhattan_distance(a: Vector3i, b: Vector3i) -> int:
@@ -1,11 +1,16 @@
 ## TerrainGenerator - Simple, fast terrain generation
-## Basic heightmap-based terrain with hills and valleys
+## Heightmap-based terrain with hills and valleys, 3D caves and ore veins underground
+## Cave noise is only evaluated on a coarse 4x4x4 lattice (trilinearly interpolated per
+## voxel) and only for chunks reaching below the cave ceiling under the surface band
 class_name TerrainGenerator
 extends RefCounted
 
 ## Single noise generator for terrain
 var terrain_noise: FastNoiseLite
 
+## 3D noise carving caves where it exceeds CAVE_THRESHOLD
+var cave_noise: FastNoiseLite
+
 ## World seed for consistent generation
 var world_seed: int = 0
 
@@ -14,12 +19,28 @@ var world_seed: int = 0
 @export var height_scale: float = 24.0     # Max terrain height variation
 @export var terrain_frequency: float = 0.015  # Terrain features scale
 
-## Height cache for performance (avoid recalculating same columns)
-var height_cache: Dictionary = {}
-const MAX_CACHE_SIZE: int = 2000
-
-## Mutex for thread-safe cache access
-var cache_mutex: Mutex = Mutex.new()
+## Layers at the top of a column that can differ from the type below them (surface band);
+## every voxel deeper than terrain_height - SURFACE_BAND_DEPTH has the column's deep type
+const SURFACE_BAND_DEPTH: int = 3
+
+## Caves: noise lattice spacing, carve threshold, solid roof kept under the surface band,
+## and lowest carved Y (keeps a solid floor)
+const CAVE_LATTICE_STEP: int = 4
+const CAVE_THRESHOLD: float = 0.45
+const CAVE_ROOF_DEPTH: int = 6
+const CAVE_MIN_Y: int = -56
+
+## Ore veins: random walks of `length` steps replacing stone below max_y,
+## `veins` per chunk on average (the fraction is rolled)
+const ORE_VEINS: Array[Dictionary] = [
+	{"type": VoxelTypes.Type.COAL_ORE, "max_y": 56, "veins": 1.5, "length": 8},
+	{"type": VoxelTypes.Type.IRON_ORE, "max_y": 40, "veins": 0.8, "length": 6},
+	{"type": VoxelTypes.Type.GOLD_ORE, "max_y": 12, "veins": 0.3, "length": 5}
+]
+
+## Height cache for performance: 32x32 column tiles shared by all worker threads
+## (every chunk of a vertical stack reads the same tile)
+var height_cache: HeightTileCache = HeightTileCache.new()
 
 func _init(seed_value: int = 0) -> void:
 	if seed_value == 0:
@@ -38,6 +59,13 @@ func _setup_noise_generators() -> void:
 	terrain_noise.fractal_lacunarity = 2.0
 	terrain_noise.fractal_gain = 0.5
 
+	# Cave noise (single octave - it is only sampled on the coarse lattice anyway)
+	cave_noise = FastNoiseLite.new()
+	cave_noise.seed = world_seed + 1
+	cave_noise.noise_type = FastNoiseLite.TYPE_PERLIN
+	cave_noise.frequency = 0.035
+	cave_noise.fractal_type = FastNoiseLite.FRACTAL_NONE
+
 ## Generate a complete chunk of voxel data
 func generate_chunk(chunk_pos: Vector3i) -> VoxelData:
 	var voxel_data := VoxelData.new(chunk_pos)
@@ -49,76 +77,301 @@ func generate_chunk(chunk_pos: Vector3i) -> VoxelData:
 
 	# Get the actual height for this specific chunk
 	var chunk_height := voxel_data.chunk_size_y
+	var chunk_end_y := chunk_start_y + chunk_height - 1
+
+	# OPTIMIZATION: The chunk's 16x16 columns come from one cached height tile (one shard
+	# lock per chunk, sampled in a single batched pass on a miss), read without locking
+	var tile := height_cache.get_tile(HeightTileCache.world_to_tile(chunk_start_x, chunk_start_z), self)
+	var column_heights := tile.heights
+	var tile_offset := (chunk_start_x & (HeightTileCache.TILE_SIZE - 1)) + (chunk_start_z & (HeightTileCache.TILE_SIZE - 1)) * HeightTileCache.TILE_SIZE
+
+	# OPTIMIZATION: Classify the chunk from its column heights before touching voxels -
+	# most of a vertical stack is entirely air, water or deep stone
+	var uniform_type := _get_uniform_type(column_heights, tile_offset, chunk_start_y, chunk_end_y)
+	if uniform_type == VoxelTypes.Type.AIR or uniform_type == VoxelTypes.Type.WATER:
+		voxel_data.fill(uniform_type)
+		voxel_data.is_enclosed = uniform_type == VoxelTypes.Type.WATER and chunk_end_y < get_sea_level()
+		return voxel_data
+
+	# Underground content: the cave lattice (only if the chunk reaches below a cave ceiling)
+	# and this chunk's ore veins
+	var cave_lattice := PackedFloat32Array()
+	var caves_nearby := false
+	if _may_have_caves(column_heights, tile_offset, chunk_start_y, chunk_end_y):
+		cave_lattice = _sample_cave_lattice(chunk_start_x, chunk_start_y, chunk_start_z, chunk_height)
+		for value in cave_lattice:
+			if value >= CAVE_THRESHOLD:
+				caves_nearby = true
+				break
+	var veins := _roll_ore_veins(chunk_pos, chunk_start_y, chunk_end_y)
+
+	# Deep ground without caves or ore stays uniform
+	if uniform_type >= 0 and not caves_nearby and veins.is_empty():
+		voxel_data.fill(uniform_type)
+		voxel_data.is_enclosed = _is_solid_chunk_enclosed(chunk_start_x, chunk_start_y, chunk_start_z, chunk_end_y, not cave_lattice.is_empty())
+		return voxel_data
+
+	# Write each column as spans (deep layer, surface band, water) into a flat buffer, then
+	# build the palette storage once (zero bytes are AIR)
+	var flat := PackedByteArray()
+	flat.resize(voxel_data.get_chunk_volume())
+	if uniform_type >= 0:
+		flat.fill(uniform_type)
+	else:
+		_fill_columns(flat, column_heights, tile_offset, chunk_start_y, chunk_height)
 
-	# OPTIMIZATION: Pre-calculate heights using PackedInt32Array instead of Dictionary
-	# Avoids Vector2i allocations and is cache-friendly
-	var column_heights := PackedInt32Array()
-	column_heights.resize(VoxelData.CHUNK_SIZE_XZ * VoxelData.CHUNK_SIZE_XZ)
-
-	for x in range(VoxelData.CHUNK_SIZE_XZ):
-		for z in range(VoxelData.CHUNK_SIZE_XZ):
-			var world_x := chunk_start_x + x
-			var world_z := chunk_start_z + z
-			var index := x * VoxelData.CHUNK_SIZE_XZ + z
-			column_heights[index] = get_terrain_height(world_x, world_z)
-
-	# Fill voxels
-	for x in range(VoxelData.CHUNK_SIZE_XZ):
-		for z in range(VoxelData.CHUNK_SIZE_XZ):
-			var index := x * VoxelData.CHUNK_SIZE_XZ + z
-			var terrain_height: int = column_heights[index]
-
-			for y in range(chunk_height):
-				var world_x := chunk_start_x + x
-				var world_y := chunk_start_y + y
-				var world_z := chunk_start_z + z
-				var world_pos := Vector3i(world_x, world_y, world_z)
-
-				# Determine voxel type
-				var voxel_type := _get_voxel_at_position(world_pos, terrain_height)
-
-				# Only set non-air voxels (sparse storage)
-				if voxel_type != VoxelTypes.Type.AIR:
-					voxel_data.set_voxel(Vector3i(x, y, z), voxel_type)
-
-	# Manage cache size (thread-safe check)
-	cache_mutex.lock()
-	var should_clear := height_cache.size() > MAX_CACHE_SIZE
-	cache_mutex.unlock()
-
-	if should_clear:
-		_clear_old_cache_entries()
+	if caves_nearby:
+		_carve_caves(flat, cave_lattice, column_heights, tile_offset, chunk_start_y, chunk_height)
+	_place_ore_veins(flat, veins, chunk_start_y, chunk_height)
 
-	return voxel_data
+	voxel_data.load_from_byte_array(flat)
 
-## Get terrain height at a specific XZ position
-func get_terrain_height(world_x: int, world_z: int) -> int:
-	# OPTIMIZATION: Use integer hash instead of Vector2i to avoid allocations
-	var cache_key := _hash_position(world_x, world_z)
+	# Ore-only deep ground is still fully opaque
+	if uniform_type >= 0 and not caves_nearby:
+		voxel_data.is_enclosed = _is_solid_chunk_enclosed(chunk_start_x, chunk_start_y, chunk_start_z, chunk_end_y, not cave_lattice.is_empty())
 
-	# Check cache first (thread-safe)
-	cache_mutex.lock()
-	var cached_height: Variant = height_cache.get(cache_key)
-	cache_mutex.unlock()
+	return voxel_data
 
-	if cached_height != null:
-		return cached_height
+## Write every column of a chunk into a flat buffer as spans: deep layer, surface band
+## (grass, dirt, sand, gravel) and water above low terrain
+func _fill_columns(flat: PackedByteArray, column_heights: PackedInt32Array, tile_offset: int, start_y: int, size_y: int) -> void:
+	var end_y := start_y + size_y - 1
+	var sea_level := get_sea_level()
+	var y_stride := VoxelData.CHUNK_SIZE_XZ
+	var z_stride := VoxelData.CHUNK_SIZE_XZ * size_y
+
+	for z in range(VoxelData.CHUNK_SIZE_XZ):
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			var terrain_height: int = column_heights[tile_offset + x + z * HeightTileCache.TILE_SIZE]
+			var column := x + z * z_stride
+			var band_bottom := terrain_height - SURFACE_BAND_DEPTH + 1
+
+			# Deep span (everything below the surface band has one type)
+			var deep_end := mini(band_bottom - 1, end_y)
+			if deep_end >= start_y:
+				var deep_type := _get_voxel_at_position(Vector3i(0, band_bottom - 1, 0), terrain_height)
+				_fill_span(flat, column, y_stride, 0, deep_end - start_y, deep_type)
+
+			# Surface band (grass, dirt, sand, gravel)
+			for world_y in range(maxi(band_bottom, start_y), mini(terrain_height, end_y) + 1):
+				flat[column + (world_y - start_y) * y_stride] = _get_voxel_at_position(Vector3i(0, world_y, 0), terrain_height)
+
+			# Water span above low terrain
+			var water_start := maxi(terrain_height + 1, start_y)
+			var water_end := mini(sea_level, end_y)
+			if water_end >= water_start:
+				_fill_span(flat, column, y_stride, water_start - start_y, water_end - start_y, VoxelTypes.Type.WATER)
+
+## Block type filling the whole chunk Y range [start_y, end_y] in every column, or -1 if
+## any column crosses a layer boundary or two columns disagree
+func _get_uniform_type(column_heights: PackedInt32Array, tile_offset: int, start_y: int, end_y: int) -> int:
+	var sea_level := get_sea_level()
+	var uniform_type := -1
+	for z in range(VoxelData.CHUNK_SIZE_XZ):
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			var terrain_height: int = column_heights[tile_offset + x + z * HeightTileCache.TILE_SIZE]
+			var column_type := -1
+			if end_y <= terrain_height - SURFACE_BAND_DEPTH:
+				column_type = _get_voxel_at_position(Vector3i(0, end_y, 0), terrain_height)
+			elif start_y > terrain_height:
+				if start_y > sea_level:
+					column_type = VoxelTypes.Type.AIR
+				elif end_y <= sea_level:
+					column_type = VoxelTypes.Type.WATER
+
+			if column_type < 0 or (uniform_type >= 0 and column_type != uniform_type):
+				return -1
+			uniform_type = column_type
+	return uniform_type
+
+## Check if a fully solid chunk has no visible faces whatever its neighbors hold: the
+## surrounding columns must be solid over the whole chunk height (the columns above it are
+## solid by construction) and no cave may open next to it - either the cave lattice around
+## the chunk was sampled and is clear, or the neighbors' cave ceilings are below the chunk
+func _is_solid_chunk_enclosed(start_x: int, start_y: int, start_z: int, end_y: int, caves_sampled_clear: bool) -> bool:
+	for i in range(VoxelData.CHUNK_SIZE_XZ):
+		for neighbor_column in [
+				Vector2i(start_x - 1, start_z + i), Vector2i(start_x + VoxelData.CHUNK_SIZE_XZ, start_z + i),
+				Vector2i(start_x + i, start_z - 1), Vector2i(start_x + i, start_z + VoxelData.CHUNK_SIZE_XZ)]:
+			var height := get_terrain_height(neighbor_column.x, neighbor_column.y)
+			if height < end_y:
+				return false
+			if not caves_sampled_clear and _get_cave_ceiling(height) >= start_y:
+				return false
+	return true
+
+## Highest Y caves may carve in a column (keeps a solid roof under the surface band)
+func _get_cave_ceiling(terrain_height: int) -> int:
+	return terrain_height - SURFACE_BAND_DEPTH - CAVE_ROOF_DEPTH
+
+## Check if any column's cave range overlaps the chunk, with one lattice cell of margin so
+## caves just outside the chunk are seen by the enclosure test too
+func _may_have_caves(column_heights: PackedInt32Array, tile_offset: int, start_y: int, end_y: int) -> bool:
+	if end_y < CAVE_MIN_Y - CAVE_LATTICE_STEP:
+		return false
+	var max_height := 0
+	for z in range(VoxelData.CHUNK_SIZE_XZ):
+		for x in range(VoxelData.CHUNK_SIZE_XZ):
+			max_height = maxi(max_height, column_heights[tile_offset + x + z * HeightTileCache.TILE_SIZE])
+	return start_y <= _get_cave_ceiling(max_height) + CAVE_LATTICE_STEP
+
+## Sample cave noise on the chunk's lattice, extended by one cell on every side
+## Indexed x + z * points_xz + y * points_xz^2 (lattice point 1 is the chunk origin)
+func _sample_cave_lattice(start_x: int, start_y: int, start_z: int, size_y: int) -> PackedFloat32Array:
+	var points_xz := VoxelData.CHUNK_SIZE_XZ / CAVE_LATTICE_STEP + 3
+	var points_y := size_y / CAVE_LATTICE_STEP + 3
+	var lattice := PackedFloat32Array()
+	lattice.resize(points_xz * points_xz * points_y)
+
+	var index := 0
+	for py in range(points_y):
+		var world_y := start_y + (py - 1) * CAVE_LATTICE_STEP
+		for pz in range(points_xz):
+			var world_z := start_z + (pz - 1) * CAVE_LATTICE_STEP
+			for px in range(points_xz):
+				lattice[index] = cave_noise.get_noise_3d(start_x + (px - 1) * CAVE_LATTICE_STEP, world_y, world_z)
+				index += 1
+	return lattice
+
+## Carve caves into a flat chunk buffer from the interpolated lattice
+## Lattice cells whose 8 corners are all below the threshold are skipped whole
+## (trilinear interpolation never exceeds its largest corner)
+func _carve_caves(flat: PackedByteArray, lattice: PackedFloat32Array, column_heights: PackedInt32Array,
+				  tile_offset: int, start_y: int, size_y: int) -> void:
+	var step := CAVE_LATTICE_STEP
+	var inv_step := 1.0 / step
+	var points_xz := VoxelData.CHUNK_SIZE_XZ / step + 3
+	var points_layer := points_xz * points_xz
+	var y_stride := VoxelData.CHUNK_SIZE_XZ
+	var z_stride := VoxelData.CHUNK_SIZE_XZ * size_y
+
+	for cy in range(size_y / step):
+		for cz in range(VoxelData.CHUNK_SIZE_XZ / step):
+			for cx in range(VoxelData.CHUNK_SIZE_XZ / step):
+				# Cell corners (lattice point 1 is the chunk origin)
+				var i000 := (cx + 1) + (cz + 1) * points_xz + (cy + 1) * points_layer
+				var c000 := lattice[i000]
+				var c100 := lattice[i000 + 1]
+				var c010 := lattice[i000 + points_layer]
+				var c110 := lattice[i000 + points_layer + 1]
+				var c001 := lattice[i000 + points_xz]
+				var c101 := lattice[i000 + points_xz + 1]
+				var c011 := lattice[i000 + points_layer + points_xz]
+				var c111 := lattice[i000 + points_layer + points_xz + 1]
+				if maxf(maxf(maxf(c000, c100), maxf(c010, c110)), maxf(maxf(c001, c101), maxf(c011, c111))) < CAVE_THRESHOLD:
+					continue
+
+				for lz in range(step):
+					var fz := lz * inv_step
+					var z := cz * step + lz
+					for lx in range(step):
+						var fx := lx * inv_step
+						var x := cx * step + lx
+						var ceiling := _get_cave_ceiling(column_heights[tile_offset + x + z * HeightTileCache.TILE_SIZE])
+						# Interpolate along x and z once per column of the cell
+						var bottom := lerpf(lerpf(c000, c100, fx), lerpf(c001, c101, fx), fz)
+						var top := lerpf(lerpf(c010, c110, fx), lerpf(c011, c111, fx), fz)
+						for ly in range(step):
+							var world_y := start_y + cy * step + ly
+							if world_y > ceiling or world_y < CAVE_MIN_Y:
+								continue
+							if lerpf(bottom, top, ly * inv_step) >= CAVE_THRESHOLD:
+								flat[x + z * z_stride + (cy * step + ly) * y_stride] = VoxelTypes.Type.AIR
+
+## Roll this chunk's ore veins (deterministic per seed and chunk)
+## Returns 4 ints per vein: local start x, y, z and the ORE_VEINS index
+func _roll_ore_veins(chunk_pos: Vector3i, start_y: int, end_y: int) -> PackedInt32Array:
+	var veins := PackedInt32Array()
+	var rng := RandomNumberGenerator.new()
+	rng.seed = hash(Vector4i(world_seed, chunk_pos.x, chunk_pos.y, chunk_pos.z))
+
+	for ore_index in range(ORE_VEINS.size()):
+		var ore: Dictionary = ORE_VEINS[ore_index]
+		var top_y := mini(end_y, ore.max_y)
+		if top_y < start_y:
+			continue
+		var rate: float = ore.veins
+		var count := int(rate) + (1 if rng.randf() < rate - int(rate) else 0)
+		for v in range(count):
+			veins.append(rng.randi_range(0, VoxelData.CHUNK_SIZE_XZ - 1))
+			veins.append(rng.randi_range(0, top_y - start_y))
+			veins.append(rng.randi_range(0, VoxelData.CHUNK_SIZE_XZ - 1))
+			veins.append(ore_index)
+	return veins
+
+## Walk each vein from its start, turning stone into ore (veins are clipped to the chunk)
+func _place_ore_veins(flat: PackedByteArray, veins: PackedInt32Array, start_y: int, size_y: int) -> void:
+	if veins.is_empty():
+		return
+	var rng := RandomNumberGenerator.new()
+	rng.seed = hash(veins)
+	var y_stride := VoxelData.CHUNK_SIZE_XZ
+	var z_stride := VoxelData.CHUNK_SIZE_XZ * size_y
+
+	for v in range(0, veins.size(), 4):
+		var ore: Dictionary = ORE_VEINS[veins[v + 3]]
+		var ore_type: int = ore.type
+		var max_local_y: int = ore.max_y - start_y
+		var pos := Vector3i(veins[v], veins[v + 1], veins[v + 2])
+		for step in range(ore.length):
+			if (pos.x >= 0 and pos.x < VoxelData.CHUNK_SIZE_XZ and pos.z >= 0 and pos.z < VoxelData.CHUNK_SIZE_XZ
+					and pos.y >= 0 and pos.y < size_y and pos.y <= max_local_y):
+				var index := pos.x + pos.z * z_stride + pos.y * y_stride
+				if flat[index] == VoxelTypes.Type.STONE:
+					flat[index] = ore_type
+			pos += Vector3i(rng.randi_range(-1, 1), rng.randi_range(-1, 1), rng.randi_range(-1, 1))
+
+## Write one block type to local Y first_y..last_y of a column in a flat chunk buffer
+static func _fill_span(flat: PackedByteArray, column: int, y_stride: int, first_y: int, last_y: int, voxel_type: int) -> void:
+	for index in range(column + first_y * y_stride, column + last_y * y_stride + 1, y_stride):
+		flat[index] = voxel_type
+
+## Get terrain height at a specific XZ position (cached, thread-safe)
+func get_terrain_height(world_x: int, world_z: int) -> int:
+	return height_cache.get_height(world_x, world_z, self)
 
+## Compute terrain height at a specific XZ position without touching the cache
+## Used directly by bulk samplers (LOD mips) that would otherwise flush the height cache
+func sample_terrain_height(world_x: int, world_z: int) -> int:
 	# Simple single-layer noise
 	var noise_value := terrain_noise.get_noise_2d(world_x, world_z)
 
-	# Convert to height (-1 to 1 -> height range)
-	var height := int(base_height + noise_value * height_scale)
-
-	# Clamp to reasonable values
-	height = clampi(height, 0, 255)
-
-	# Cache the result (thread-safe)
-	cache_mutex.lock()
-	height_cache[cache_key] = height
-	cache_mutex.unlock()
-
-	return height
+	# Convert to height (-1 to 1 -> height range), clamped to reasonable values
+	return clampi(int(base_height + noise_value * height_scale), 0, 255)
+
+## Sample a size_x x size_z grid of terrain heights into heights (indexed x + z * size_x),
+## starting at world (origin_x, origin_z) with samples step blocks apart
+## Same values as sample_terrain_height, but the noise object, parameters and output
+## buffer are resolved once for the whole grid instead of once per column
+## heights is resized if too small, so callers can keep reusing one buffer
+func sample_heights(origin_x: int, origin_z: int, size_x: int, size_z: int,
+					heights: PackedInt32Array, step: int = 1) -> void:
+	if heights.size() < size_x * size_z:
+		heights.resize(size_x * size_z)
+
+	var noise := terrain_noise
+	var base := float(base_height)
+	var scale := height_scale
+	var index := 0
+	for z in range(size_z):
+		var world_z := origin_z + z * step
+		var world_x := origin_x
+		for x in range(size_x):
+			heights[index] = clampi(int(base + noise.get_noise_2d(world_x, world_z) * scale), 0, 255)
+			world_x += step
+			index += 1
+
+## Highest world Y filled with water where the terrain is lower
+func get_sea_level() -> int:
+	return base_height - 2
+
+## Block types of a column's top voxel and the voxel below it, for a given terrain height
+## Returns Vector2i(surface type, subsurface type)
+func get_column_types(terrain_height: int) -> Vector2i:
+	return Vector2i(
+		_get_voxel_at_position(Vector3i(0, terrain_height, 0), terrain_height),
+		_get_voxel_at_position(Vector3i(0, terrain_height - 1, 0), terrain_height)
+	)
 
 ## Determine voxel type at a specific world position
 func _get_voxel_at_position(world_pos: Vector3i, terrain_height: int) -> int:
@@ -127,7 +380,7 @@ func _get_voxel_at_position(world_pos: Vector3i, terrain_height: int) -> int:
 	# Above terrain - air
 	if y > terrain_height:
 		# Fill below sea level with water
-		if y <= base_height - 2:
+		if y <= get_sea_level():
 			return VoxelTypes.Type.WATER
 		return VoxelTypes.Type.AIR
 
@@ -175,22 +428,10 @@ func _get_voxel_at_position(world_pos: Vector3i, terrain_height: int) -> int:
 	# Default - stone
 	return VoxelTypes.Type.STONE
 
-## Clear old entries from height cache
-func _clear_old_cache_entries() -> void:
-	cache_mutex.lock()
-	var keys := height_cache.keys()
-	var to_remove := keys.size() - MAX_CACHE_SIZE / 2
-
-	for i in range(to_remove):
-		height_cache.erase(keys[i])
-	cache_mutex.unlock()
-
 ## Set new world seed (clears cache)
 func set_world_seed(new_seed: int) -> void:
 	world_seed = new_seed
-	cache_mutex.lock()
 	height_cache.clear()
-	cache_mutex.unlock()
 	_setup_noise_generators()
 
 ## Get current world seed
@@ -201,11 +442,6 @@ func get_world_seed() -> int:
 func clear_cache() -> void:
 	height_cache.clear()
 
-## Hash function for XZ coordinates to avoid Vector2i allocations
-## Uses cantor pairing function for perfect hashing
-func _hash_position(x: int, z: int) -> int:
-	# Cantor pairing function: uniquely maps two integers to one
-	# Handles negative numbers by offsetting to positive space
-	var a := x + 32768  # Offset to handle negative coords
-	var b := z + 32768
-	return ((a + b) * (a + b + 1)) / 2 + b
+## Keep the height tiles around this position when the cache evicts (call as the player moves)
+func set_cache_focus(world_position: Vector3) -> void:
+	height_cache.set_focus(world_position)
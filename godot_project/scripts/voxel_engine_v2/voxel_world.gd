@@ -12,6 +12,9 @@ extends Node3D
 @export_group("Rendering")
 @export var render_distance: int = 8
 @export var vertical_render_distance: int = 4
+@export var lod_distance: int = 48  # Downsampled terrain radius in chunks
+@export var far_terrain_rings: int = 3  # Heightfield horizon rings (0 = none, each doubles the reach)
+@export var enable_lighting: bool = true  # Baked block light and sunlight in chunk meshes
 
 @export_group("Performance")
 @export var enable_chunk_pooling: bool = true
@@ -51,6 +54,9 @@ func _ready() -> void:
 	print("  - world_seed: %d" % world_seed)
 	print("  - render_distance: %d" % render_distance)
 	print("  - vertical_render_distance: %d" % vertical_render_distance)
+	print("  - lod_distance: %d" % lod_distance)
+	print("  - far_terrain_rings: %d" % far_terrain_rings)
+	print("  - enable_lighting: %s" % enable_lighting)
 	print("  - enable_auto_generation: %s" % enable_auto_generation)
 	print("  - enable_chunk_pooling: %s" % enable_chunk_pooling)
 	print("  - chunk_pool_size: %d" % chunk_pool_size)
@@ -247,6 +253,9 @@ func _initialize_systems() -> void:
 	chunk_manager = ChunkManager.new()
 	chunk_manager.render_distance = render_distance
 	chunk_manager.vertical_render_distance = vertical_render_distance
+	chunk_manager.lod_distance = lod_distance
+	chunk_manager.far_terrain_rings = far_terrain_rings
+	chunk_manager.enable_lighting = enable_lighting
 	chunk_manager.enable_pooling = enable_chunk_pooling
 	chunk_manager.pool_size = chunk_pool_size
 	chunk_manager.enable_threading = enable_threading  # Pass threading setting
@@ -333,6 +342,22 @@ func set_voxel(world_pos: Vector3i, voxel_type: int) -> void:
 	if chunk_manager:
 		chunk_manager.set_voxel_at_world(world_pos, voxel_type)
 
+## Set many voxels at world positions, remeshing each affected chunk once
+## (wrap several calls in begin_edit/commit to batch them together)
+func set_voxels(positions: Array[Vector3i], voxel_types: PackedByteArray) -> void:
+	if chunk_manager:
+		chunk_manager.set_voxels(positions, voxel_types)
+
+## Open an edit transaction (see ChunkManager.begin_edit)
+func begin_edit() -> void:
+	if chunk_manager:
+		chunk_manager.begin_edit()
+
+## Apply the edits of the outermost open transaction
+func commit_edit() -> void:
+	if chunk_manager:
+		chunk_manager.commit()
+
 ## Regenerate terrain with new seed
 func regenerate_world(new_seed: int = 0) -> void:
 	if new_seed == 0: